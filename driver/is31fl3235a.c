@@ -20,12 +20,50 @@
 #include <zephyr/drivers/led/is31fl3235a.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/pm/device.h>
+#include <zephyr/sys/crc.h>
 #include <zephyr/sys/util.h>
 
+#include "is31fl3235a_ease.h"
 #include "is31fl3235a_regs.h"
+#include "is31fl3235a_swar.h"
 
 LOG_MODULE_REGISTER(is31fl3235a, CONFIG_LED_LOG_LEVEL);
 
+/**
+ * @brief Initial state of one channel, taken from its device tree child node
+ */
+struct is31fl3235a_boot_channel {
+	/** First channel number (child reg) */
+	uint8_t channel;
+	/** Number of channels, one per color component */
+	uint8_t num_channels;
+	/** Initial PWM value (default-brightness) */
+	uint8_t pwm;
+	/** Initial control register value (current-scale, default-disabled) */
+	uint8_t ctrl;
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+	/** Calibration gain per channel (color-gain), NULL for unity */
+	const uint16_t *gain;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+	/** Full-scale output current (imax-microamp), 0 for the device default */
+	uint32_t imax_ua;
+#endif
+};
+
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+/**
+ * @brief Color correction applied to one RGB LED
+ */
+struct is31fl3235a_color_matrix {
+	/** Row-major 3x3 matrix, Q8 fixed point (256 = 1.0) */
+	int16_t m[9];
+	/** Red, green and blue channel numbers of the LED */
+	uint8_t ch[3];
+};
+#endif
+
 /**
  * @brief IS31FL3235A device configuration (read-only, in ROM)
  */
@@ -36,26 +74,544 @@ struct is31fl3235a_cfg {
 	struct gpio_dt_spec sdb_gpio;
 	/** PWM frequency: false=3kHz, true=22kHz */
 	bool pwm_freq_22khz;
+	/** Boot frame, one entry per device tree child node */
+	const struct is31fl3235a_boot_channel *boot_frame;
+	/** Number of entries in boot_frame */
+	uint8_t boot_frame_len;
+	/** LEDs described by child nodes, indexed by logical LED number */
+	const struct led_info *leds;
+	/** Number of entries in leds */
+	uint8_t num_leds;
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+	/** Default full-scale output current per channel (imax-microamp) */
+	uint32_t imax_ua;
+	/** Initial total current budget (current-budget-microamp), 0 = none */
+	uint32_t budget_ua;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+	/** Color matrix storage, one per entry in leds */
+	struct is31fl3235a_color_matrix *matrices;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_REMAP
+	/** Physical output of each logical channel (channel-map), or NULL */
+	const uint8_t *channel_map;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_RETAINED_STATE
+	/** Copy of the shadow that survives a warm reboot */
+	struct is31fl3235a_retained *retained;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_QUEUE
+	/** Storage of the frame queue */
+	char *queue_buf;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
+	/** Channels of each partition, from the partition child property */
+	const uint32_t *part_masks;
+#endif
+};
+
+#ifdef CONFIG_LED_IS31FL3235A_RETAINED_STATE
+/* Marks a retained block written by this driver */
+#define IS31FL3235A_RETAINED_MAGIC	0x33423541U
+
+/* Bits of is31fl3235a_retained.flags */
+#define IS31FL3235A_RETAINED_SW_SHUTDOWN	BIT(0)
+#define IS31FL3235A_RETAINED_GLOBAL_ENABLE	BIT(1)
+
+/**
+ * @brief Register state kept in RAM that is not cleared on reboot
+ */
+struct is31fl3235a_retained {
+	/** IS31FL3235A_RETAINED_MAGIC once written */
+	uint32_t magic;
+	/** PWM values last written to the chip */
+	uint8_t pwm[IS31FL3235A_NUM_CHANNELS];
+	/** Control register values last written to the chip */
+	uint8_t ctrl[IS31FL3235A_NUM_CHANNELS];
+	/** IS31FL3235A_RETAINED_* flags */
+	uint8_t flags;
+	/** CRC-32 of all preceding fields */
+	uint32_t crc;
+};
+#endif
+
+/* Pending writes to non-channel registers, tracked in sync_flags */
+#define IS31FL3235A_SYNC_UPDATE		BIT(0)
+#define IS31FL3235A_SYNC_SHUTDOWN	BIT(1)
+#define IS31FL3235A_SYNC_GLOBAL		BIT(2)
+#define IS31FL3235A_SYNC_FREQ		BIT(3)
+#define IS31FL3235A_SYNC_ALL		(IS31FL3235A_SYNC_UPDATE |		\
+					 IS31FL3235A_SYNC_SHUTDOWN |		\
+					 IS31FL3235A_SYNC_GLOBAL |		\
+					 IS31FL3235A_SYNC_FREQ)
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+/* Scheduled commits: start holding updates after this write, or latch */
+#define IS31FL3235A_SYNC_PRELOAD	BIT(4)
+#define IS31FL3235A_SYNC_LATCH		BIT(5)
+#endif
+
+BUILD_ASSERT(IS31FL3235A_REG_FREQ == IS31FL3235A_REG_GLOBAL_CTRL + 1,
+	     "global control and frequency registers must be adjacent");
+
+/* PWM values pass through is31fl3235a_render() on their way to the chip */
+#if defined(CONFIG_LED_IS31FL3235A_GAMMA) ||				\
+	defined(CONFIG_LED_IS31FL3235A_CALIBRATION) ||				\
+	defined(CONFIG_LED_IS31FL3235A_DIMMER) ||				\
+	defined(CONFIG_LED_IS31FL3235A_CURRENT_LIMIT)
+#define IS31FL3235A_RENDER 1
+#endif
+
+/* Transitions follow the easing curves */
+#if defined(CONFIG_LED_IS31FL3235A_FADE) || defined(CONFIG_LED_IS31FL3235A_EFFECTS)
+#define IS31FL3235A_EASING 1
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_ASYNC_INIT
+/* Deferred bring-up progress of one instance */
+enum is31fl3235a_boot_stage {
+	IS31FL3235A_BOOT_IDLE,
+	IS31FL3235A_BOOT_RESET,
+	IS31FL3235A_BOOT_PROGRAM,
+	/* Retries used up; API calls fail with -ENODEV */
+	IS31FL3235A_BOOT_FAILED,
+};
+
+/* Retries of a failed deferred bring-up step, with doubling delay */
+#define IS31FL3235A_BOOT_RETRIES	3
+#define IS31FL3235A_BOOT_RETRY_DELAY_MS	10
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_CLOCK
+/* Highest frame clock rate accepted */
+#define IS31FL3235A_FRAME_CLOCK_MAX_FPS	1000U
+#endif
+
+/* Bitmap covering every channel */
+#define IS31FL3235A_ALL_CHANNELS	BIT_MASK(IS31FL3235A_NUM_CHANNELS)
+
+/*
+ * Largest run of clean registers bridged when coalescing dirty channels
+ * into one burst. Rewriting a couple of unchanged bytes is cheaper than
+ * the start, address and register bytes of another transaction.
+ */
+#define IS31FL3235A_SPAN_MAX_GAP	2
+
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
+/**
+ * @brief Channel partition: a set of channels with its own lock
+ *
+ * Writers of a partition stage into it under its own spinlock; the
+ * flusher moves the staged values into the device shadow, so writers of
+ * different partitions never contend while staging. Waiting for the
+ * flush still serializes on bus_lock.
+ */
+struct is31fl3235a_partition {
+	/** Device owning the channels */
+	const struct device *dev;
+	/** Spinlock protecting the staged values and dirty state */
+	struct k_spinlock lock;
+	/** Channels owned by the partition */
+	uint32_t mask;
+	/** Staged PWM values, indexed by channel */
+	uint8_t pwm[IS31FL3235A_NUM_CHANNELS];
+	/** Bitmap of staged channels not yet moved into the shadow */
+	uint32_t dirty;
+	/** Sequence number of the latest modification */
+	uint32_t seq;
+	/** Sequence number covered by the last completed flush */
+	uint32_t flushed_seq;
+	/** Result of the last completed flush */
+	int flush_ret;
+};
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+/**
+ * @brief Blink state of one channel
+ *
+ * Linked into a slot of the shared timer wheel while the channel blinks.
+ * The wheel fields are protected by the wheel lock; the current phase is
+ * the channel's bit in the device's blink_off mask.
+ */
+struct is31fl3235a_blink {
+	/** Node in the wheel slot due at the next phase change */
+	sys_dnode_t node;
+	/** Device owning the channel */
+	const struct device *dev;
+	/** On phase length in wheel ticks */
+	uint32_t on_ticks;
+	/** Off phase length in wheel ticks */
+	uint32_t off_ticks;
+	/** Full wheel turns left before the phase change is due */
+	uint32_t rounds;
+	/** Channel number */
+	uint8_t channel;
+};
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_EFFECTS
+/**
+ * @brief State of an attached effect
+ *
+ * Protected by the device spinlock. Breathe and heartbeat track their
+ * time within the period; chase, sparkle and comet accumulate time until
+ * the next step and remember which channels are still lit.
+ */
+struct is31fl3235a_effect_state {
+	/** Parameters given when attaching */
+	struct is31fl3235a_effect fx;
+	/** Channels driven by the effect; 0 if the slot is free */
+	uint32_t mask;
+	/** Breathe, heartbeat: time within the period in milliseconds */
+	uint32_t t_ms;
+	/** Stepping effects: elapsed milliseconds times channels, per step */
+	uint32_t acc;
+	/** Stepping effects: channels not yet faded out */
+	uint32_t lit;
+	/** Sparkle: random number generator state */
+	uint32_t rng;
+	/** Breathe, heartbeat: level last written */
+	uint8_t level;
+	/** Stepping effects: channel lit by the last step */
+	uint8_t head;
+	/** Breathe: easing curve points */
+	const uint16_t *lut;
+};
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_FADE
+/**
+ * @brief State of a running fade
+ *
+ * Protected by the device spinlock.
+ */
+struct is31fl3235a_fade_state {
+	/** Channels still fading; 0 if the slot is free */
+	uint32_t mask;
+	/** Uptime at the start of the fade in milliseconds */
+	uint32_t start_ms;
+	/** Length of the fade in milliseconds */
+	uint32_t duration_ms;
+	/** Easing curve points */
+	const uint16_t *lut;
+	/** Values at the start, indexed by channel */
+	union is31fl3235a_frame from;
+	/** Final values, indexed by channel */
+	union is31fl3235a_frame to;
+};
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+/* RGB LEDs fit in the channels at most this many times */
+#define IS31FL3235A_MAX_RGB_LEDS (IS31FL3235A_NUM_CHANNELS / 3)
+#endif
+
+/**
+ * @brief Shadow state copied by the flusher for use outside the spinlock
+ *
+ * The flusher fills it under the spinlock together with the control
+ * snapshot, then blends and renders from it with the spinlock released.
+ * Protected by bus_lock.
+ */
+struct is31fl3235a_snapshot {
+	/** Logical PWM values (pwm_cache) */
+	union is31fl3235a_frame pwm;
+#ifdef CONFIG_LED_IS31FL3235A_COMPOSITOR
+	/** Layer contents */
+	union is31fl3235a_frame layer[CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS];
+	/** Layer opacity per channel */
+	union is31fl3235a_frame alpha[CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS];
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	/** Bitmap of blinking channels in their off phase */
+	uint32_t blink_off;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+	/** Calibration gain with the master dimmer folded in, Q8 */
+	uint16_t eff_gain[IS31FL3235A_NUM_CHANNELS];
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+	/** Color matrices in use */
+	struct is31fl3235a_color_matrix matrix[IS31FL3235A_MAX_RGB_LEDS];
+	/** Number of entries of matrix[] in use */
+	uint8_t num_matrices;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_DIMMER
+	/** Master dimmer level */
+	uint8_t master;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+	/** Total current budget in uA, 0 = unlimited */
+	uint32_t budget_ua;
+#endif
 };
 
 /**
  * @brief IS31FL3235A runtime data (read-write, in RAM)
+ *
+ * The caches form a shadow of the chip registers. Writers update the
+ * shadow under @ref lock, a spinlock held only for a few memory
+ * operations, and then flush. The flusher holding @ref bus_lock copies
+ * whatever is dirty at that moment and performs the I2C transfers with
+ * the spinlock released, so other threads can keep staging changes while
+ * the bus is busy. Every shadow modification gets a sequence number; a
+ * writer returns once a flush covering its sequence number completed,
+ * whether it performed that flush itself or another thread did.
  */
 struct is31fl3235a_data {
-	/** Mutex for thread-safe access */
-	struct k_mutex lock;
-	/** Initialization complete flag */
+	/** Spinlock protecting the shadow and dirty state */
+	struct k_spinlock lock;
+	/** Mutex serializing bus access, held by the active flusher */
+	struct k_mutex bus_lock;
+	/** Chip programmed; flushes before this only stage into the shadow */
 	bool initialized;
 	/** Software shutdown state */
 	bool sw_shutdown;
 	/** Hardware shutdown state (if SDB pin configured) */
 	bool hw_shutdown;
+	/** Global LED output enable state */
+	bool global_enable;
+	/** Device suspended through power management */
+	bool pm_suspended;
+	/** Bus access gated off while suspended; writes stay in the shadow */
+	bool bus_suspended;
+#ifdef CONFIG_LED_IS31FL3235A_AUTO_IDLE
+	/** Software shutdown entered by the auto-idle policy, protected by bus_lock */
+	bool idle_shutdown;
+	/** Enters software shutdown once the outputs stayed dark long enough */
+	struct k_work_delayable idle_work;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_ASYNC_INIT
+	/** Deferred bring-up progress (enum is31fl3235a_boot_stage) */
+	uint8_t boot_stage;
+	/** Failed deferred bring-up steps so far */
+	uint8_t boot_tries;
+#endif
+	/** Back-reference for work handlers */
+	const struct device *dev;
 	/** Cached PWM values for all 28 channels */
 	uint8_t pwm_cache[IS31FL3235A_NUM_CHANNELS];
 	/** Cached LED control register values for all 28 channels */
 	uint8_t ctrl_cache[IS31FL3235A_NUM_CHANNELS];
+	/** Bitmap of PWM registers not yet written to the chip */
+	uint32_t pwm_dirty;
+	/** Bitmap of control registers not yet written to the chip */
+	uint32_t ctrl_dirty;
+	/** Pending non-channel register writes (IS31FL3235A_SYNC_*) */
+	uint8_t sync_flags;
+	/** Sequence number of the latest shadow modification */
+	uint32_t seq;
+	/** Sequence number covered by the last completed flush */
+	uint32_t flushed_seq;
+	/** Result of the last completed flush */
+	int flush_ret;
+	/** I2C transfer outcome counters, protected by bus_lock */
+	struct is31fl3235a_i2c_stats i2c_stats;
+	/** Shadow copy of the flush in progress, protected by bus_lock */
+	struct is31fl3235a_snapshot snap;
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+	/** Calibration gain per channel, Q8 (256 = unity) */
+	uint16_t gain[IS31FL3235A_NUM_CHANNELS];
+	/** Gain applied by the render stage: calibration times master dimmer */
+	uint16_t eff_gain[IS31FL3235A_NUM_CHANNELS];
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+	/** Bitmap of LEDs with a color matrix in use */
+	uint32_t matrix_leds;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_DIMMER
+	/** Master dimmer level applied to every channel (255 = full) */
+	uint8_t master;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+	/** Full-scale output current per channel in uA */
+	uint32_t imax_ua[IS31FL3235A_NUM_CHANNELS];
+	/** Total current budget in uA, 0 = unlimited */
+	uint32_t budget_ua;
+	/** Estimated current of the last rendered frame in uA */
+	uint32_t current_ua;
+	/** Rendered PWM values of the last flush, to find rescaled channels */
+	union is31fl3235a_frame out_cache;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
+	/** Channel partitions from device tree */
+	struct is31fl3235a_partition part[CONFIG_LED_IS31FL3235A_PARTITION_COUNT];
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_COMPOSITOR
+	/** Layer contents, blended over pwm_cache from index 0 upwards */
+	union is31fl3235a_frame layer[CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS];
+	/** Layer opacity per channel (0 = transparent, 255 = opaque) */
+	union is31fl3235a_frame alpha[CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS];
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_FRAMEBUFFER
+	/** Mutex serializing access to the back buffer */
+	struct k_mutex frame_lock;
+	/** Frame being composed, published to pwm_cache on commit */
+	union is31fl3235a_frame back;
+	/**
+	 * Bitmap of back buffer channels written since the last commit;
+	 * atomic, as a lease merges its channels after returning frame_lock
+	 */
+	atomic_t back_dirty;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+	/** Writes the update trigger of a scheduled commit */
+	struct k_work_delayable latch_work;
+	/** A preloaded frame waits for latch_work */
+	bool latch_pending;
+	/**
+	 * The chip's staging registers hold the preloaded frame: flushes
+	 * leave PWM values and the update trigger in the shadow. Changed
+	 * under the spinlock only.
+	 */
+	bool latch_hold;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_QUEUE
+	/** Frames waiting to be preloaded and latched */
+	struct k_msgq queue;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_CLOCK
+	/** Periodic frame clock */
+	struct k_timer clock_timer;
+	/** Commits the back buffer on behalf of the frame clock */
+	struct k_work clock_work;
+	/** Cycle counter at the last clock tick */
+	uint32_t clock_tick_cyc;
+	/** Uptime in ms when the clock was started */
+	int64_t clock_start_ms;
+	/** Sum of tick to commit delays in us, for the average */
+	uint64_t clock_jitter_sum_us;
+	/** Frame clock counters, protected by lock */
+	struct is31fl3235a_frame_clock_stats clock_stats;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	/** Per-channel blink state, linked into the shared timer wheel */
+	struct is31fl3235a_blink blink[IS31FL3235A_NUM_CHANNELS];
+	/** Blinking channels currently in their off phase */
+	uint32_t blink_off;
+	/** Phase changes staged by the wheel and not yet flushed */
+	bool blink_pending;
+	/** Sequence number of the latest phase change */
+	uint32_t blink_seq;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_EFFECTS
+	/** Effect slots */
+	struct is31fl3235a_effect_state effect[CONFIG_LED_IS31FL3235A_EFFECT_SLOTS];
+	/** Channels driven by an attached effect */
+	uint32_t effect_channels;
+	/** Advances the attached effects every tick */
+	struct k_work_delayable effect_work;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_FADE
+	/** Fade slots */
+	struct is31fl3235a_fade_state fade[CONFIG_LED_IS31FL3235A_FADE_SLOTS];
+	/** Channels of the running fades */
+	uint32_t fade_channels;
+	/** Advances the running fades every tick */
+	struct k_work_delayable fade_work;
+#endif
 };
 
+#if defined(CONFIG_LED_IS31FL3235A_ASYNC_INIT) || defined(CONFIG_LED_IS31FL3235A_BLINK)
+#define IS31FL3235A_DEVICE_GET(inst) DEVICE_DT_INST_GET(inst),
+
+/* All instances, for the work items shared between them */
+static const struct device *const is31fl3235a_devices[] = {
+	DT_INST_FOREACH_STATUS_OKAY(IS31FL3235A_DEVICE_GET)
+};
+#endif
+
+/**
+ * @brief Perform one I2C write transaction
+ *
+ * @param cfg Device configuration
+ * @param reg Register address
+ * @param buf Values to write from @p reg on
+ * @param len Number of bytes in @p buf, at most IS31FL3235A_NUM_CHANNELS
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_i2c_tx(const struct is31fl3235a_cfg *cfg,
+			      uint8_t reg,
+			      const uint8_t *buf,
+			      uint32_t len)
+{
+#ifdef CONFIG_LED_IS31FL3235A_I2C_GATHER
+	/* Needs a controller that sends both messages without a RESTART */
+	struct i2c_msg msgs[2] = {
+		{ .buf = &reg, .len = 1, .flags = I2C_MSG_WRITE },
+		{ .buf = (uint8_t *)buf, .len = len, .flags = I2C_MSG_WRITE | I2C_MSG_STOP },
+	};
+
+	return i2c_transfer_dt(&cfg->i2c, msgs, ARRAY_SIZE(msgs));
+#else
+	uint8_t write_buf[IS31FL3235A_NUM_CHANNELS + 1];
+
+	write_buf[0] = reg;
+	memcpy(&write_buf[1], buf, len);
+
+	return i2c_write_dt(&cfg->i2c, write_buf, len + 1);
+#endif
+}
+
+/**
+ * @brief Perform an I2C write with the configured retry policy
+ *
+ * Failed transfers are retried with exponential backoff, then once more
+ * after bus recovery if enabled. Each outcome is counted in i2c_stats.
+ *
+ * @param dev Pointer to device structure
+ * @param reg Register address
+ * @param buf Values to write from @p reg on
+ * @param len Number of bytes in @p buf
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_i2c_write(const struct device *dev,
+				 uint8_t reg,
+				 const uint8_t *buf,
+				 uint32_t len)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	struct is31fl3235a_data *data = dev->data;
+	uint32_t delay_us = CONFIG_LED_IS31FL3235A_I2C_RETRY_DELAY_US;
+	int ret;
+
+	ret = is31fl3235a_i2c_tx(cfg, reg, buf, len);
+	if (ret == 0) {
+		data->i2c_stats.ok++;
+		return 0;
+	}
+
+	for (int i = 0; i < CONFIG_LED_IS31FL3235A_I2C_RETRIES; i++) {
+		if (delay_us > 0) {
+			k_usleep(delay_us);
+		}
+		delay_us = MIN(delay_us * 2, CONFIG_LED_IS31FL3235A_I2C_RETRY_MAX_DELAY_US);
+
+		data->i2c_stats.retries++;
+		ret = is31fl3235a_i2c_tx(cfg, reg, buf, len);
+		if (ret == 0) {
+			data->i2c_stats.retried++;
+			return 0;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_LED_IS31FL3235A_I2C_BUS_RECOVERY)) {
+		LOG_WRN("I2C write to 0x%02x failed (%d), recovering bus",
+			reg, ret);
+
+		if (i2c_recover_bus(cfg->i2c.bus) == 0) {
+			ret = is31fl3235a_i2c_tx(cfg, reg, buf, len);
+			if (ret == 0) {
+				data->i2c_stats.recovered++;
+				return 0;
+			}
+		}
+	}
+
+	data->i2c_stats.failed++;
+	return ret;
+}
+
 /**
  * @brief Write a single byte to a register
  *
@@ -66,11 +622,9 @@ struct is31fl3235a_data {
  */
 static int is31fl3235a_write_reg(const struct device *dev, uint8_t reg, uint8_t value)
 {
-	const struct is31fl3235a_cfg *cfg = dev->config;
-	uint8_t buf[2] = {reg, value};
 	int ret;
 
-	ret = i2c_write_dt(&cfg->i2c, buf, sizeof(buf));
+	ret = is31fl3235a_i2c_write(dev, reg, &value, 1);
 	if (ret < 0) {
 		LOG_ERR("Failed to write register 0x%02x: %d", reg, ret);
 		return ret;
@@ -93,18 +647,13 @@ static int is31fl3235a_write_buffer(const struct device *dev,
 				     const uint8_t *buf,
 				     size_t len)
 {
-	const struct is31fl3235a_cfg *cfg = dev->config;
-	uint8_t write_buf[256];
 	int ret;
 
-	if (len > sizeof(write_buf) - 1) {
+	if (len > IS31FL3235A_NUM_CHANNELS) {
 		return -EINVAL;
 	}
 
-	write_buf[0] = start_reg;
-	memcpy(&write_buf[1], buf, len);
-
-	ret = i2c_write_dt(&cfg->i2c, write_buf, len + 1);
+	ret = is31fl3235a_i2c_write(dev, start_reg, buf, len);
 	if (ret < 0) {
 		LOG_ERR("Failed to write %zu bytes at register 0x%02x: %d",
 			len, start_reg, ret);
@@ -115,89 +664,74 @@ static int is31fl3235a_write_buffer(const struct device *dev,
 }
 
 /**
- * @brief Trigger update of buffered PWM and control register values
+ * @brief Write the dirty registers of a 28-register channel block
  *
- * @param dev Pointer to device structure
- * @return 0 on success, negative errno on error
- */
-static inline int is31fl3235a_trigger_update(const struct device *dev)
-{
-	return is31fl3235a_write_reg(dev, IS31FL3235A_REG_UPDATE,
-				      IS31FL3235A_UPDATE_TRIGGER);
-}
-
-/**
- * @brief Set brightness for a single LED channel (standard LED API)
+ * Dirty channels are coalesced into as few bursts as possible, bridging
+ * short runs of clean registers.
  *
  * @param dev Pointer to device structure
- * @param led Channel number (0-27)
- * @param value Brightness value (0-100, percentage)
+ * @param base_reg Register address of channel 0 in the block
+ * @param vals Register values for all 28 channels
+ * @param dirty Bitmap of channels to write
  * @return 0 on success, negative errno on error
  */
-static int is31fl3235a_led_set_brightness(const struct device *dev,
-					   uint32_t led,
-					   uint8_t value)
+static int is31fl3235a_write_block(const struct device *dev,
+				    uint8_t base_reg,
+				    const uint8_t *vals,
+				    uint32_t dirty)
 {
-	struct is31fl3235a_data *data = dev->data;
-	uint8_t hw_value;
 	int ret;
 
-	if (led >= IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Invalid channel %u (max %u)", led,
-			IS31FL3235A_NUM_CHANNELS - 1);
-		return -EINVAL;
-	}
-
-	if (value > 100) {
-		LOG_ERR("Invalid brightness %u (max 100)", value);
-		return -EINVAL;
-	}
-
-	/* Convert 0-100 percentage to 0-255 hardware value */
-	hw_value = ((uint16_t)value * 255) / 100;
+	while (dirty != 0U) {
+		uint32_t first = find_lsb_set(dirty) - 1;
+		uint32_t last = first;
+
+		for (uint32_t ch = first + 1; ch < IS31FL3235A_NUM_CHANNELS; ch++) {
+			if ((dirty & BIT(ch)) == 0U) {
+				continue;
+			}
+			if (ch - last > IS31FL3235A_SPAN_MAX_GAP + 1) {
+				break;
+			}
+			last = ch;
+		}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+		ret = is31fl3235a_write_buffer(dev, base_reg + first, &vals[first],
+					       last - first + 1);
+		if (ret < 0) {
+			return ret;
+		}
 
-	/* Write PWM value to register */
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_PWM_REG(led), hw_value);
-	if (ret < 0) {
-		goto unlock;
+		dirty &= ~GENMASK(last, first);
 	}
 
-	/* Update cache */
-	data->pwm_cache[led] = hw_value;
-
-	/* Trigger update to apply change */
-	ret = is31fl3235a_trigger_update(dev);
-	if (ret < 0) {
-		goto unlock;
-	}
+	return 0;
+}
 
-	LOG_DBG("Set channel %u brightness to %u%% (hw: %u)", led, value, hw_value);
+/**
+ * @brief Check whether a flush covering a sequence number has completed
+ */
+static inline bool is31fl3235a_seq_done(uint32_t flushed_seq, uint32_t seq)
+{
+	return (int32_t)(flushed_seq - seq) >= 0;
+}
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+/**
+ * @brief Bitmap of channels in a consecutive range
+ */
+static inline uint32_t is31fl3235a_range_mask(uint32_t start_channel,
+					      uint32_t num_channels)
+{
+	return BIT_MASK(num_channels) << start_channel;
 }
 
 /**
- * @brief Write brightness values to multiple consecutive channels (standard LED API)
+ * @brief Validate a consecutive channel range
  *
- * @param dev Pointer to device structure
- * @param start_channel First channel number
- * @param num_channels Number of consecutive channels
- * @param buf Buffer containing brightness values (0-100, percentage)
- * @return 0 on success, negative errno on error
+ * @return 0 if valid, -EINVAL otherwise
  */
-static int is31fl3235a_led_write_channels(const struct device *dev,
-					   uint32_t start_channel,
-					   uint32_t num_channels,
-					   const uint8_t *buf)
+static int is31fl3235a_check_range(uint32_t start_channel, uint32_t num_channels)
 {
-	struct is31fl3235a_data *data = dev->data;
-	uint8_t hw_buf[IS31FL3235A_NUM_CHANNELS];
-	int ret;
-
 	if (start_channel >= IS31FL3235A_NUM_CHANNELS) {
 		LOG_ERR("Invalid start channel %u", start_channel);
 		return -EINVAL;
@@ -210,606 +744,3726 @@ static int is31fl3235a_led_write_channels(const struct device *dev,
 		return -EINVAL;
 	}
 
-	/* Validate and convert 0-100 percentage to 0-255 hardware values */
-	for (uint32_t i = 0; i < num_channels; i++) {
-		if (buf[i] > 100) {
-			LOG_ERR("Invalid brightness %u at index %u (max 100)",
-				buf[i], i);
-			return -EINVAL;
-		}
-		hw_buf[i] = ((uint16_t)buf[i] * 255) / 100;
-	}
-
-	k_mutex_lock(&data->lock, K_FOREVER);
+	return 0;
+}
 
-	/* Write PWM values to consecutive registers */
-	ret = is31fl3235a_write_buffer(dev, IS31FL3235A_PWM_REG(start_channel),
-					hw_buf, num_channels);
-	if (ret < 0) {
-		goto unlock;
+/**
+ * @brief Check whether a frame lights no LED at all
+ */
+static inline bool is31fl3235a_frame_is_dark(const uint8_t *pwm, bool global_enable)
+{
+	if (!global_enable) {
+		return true;
 	}
 
-	/* Update cache */
-	memcpy(&data->pwm_cache[start_channel], hw_buf, num_channels);
-
-	/* Trigger update to apply all changes simultaneously */
-	ret = is31fl3235a_trigger_update(dev);
-	if (ret < 0) {
-		goto unlock;
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		if (pwm[i] != 0U) {
+			return false;
+		}
 	}
 
-	LOG_DBG("Set channels %u-%u (%u channels)",
-		start_channel, start_channel + num_channels - 1, num_channels);
-
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+	return true;
 }
 
 /**
- * @brief Turn on LED to maximum brightness (standard LED API)
+ * @brief Copy the shadow state the flusher works on into data->snap
+ *
+ * Only copies, so the spinlock it must be called with is held for as
+ * short as possible. Callers hold bus_lock.
  *
  * @param dev Pointer to device structure
- * @param led Channel number
- * @return 0 on success, negative errno on error
  */
-static int is31fl3235a_led_on(const struct device *dev, uint32_t led)
+static void is31fl3235a_snapshot_take(const struct device *dev)
 {
-	return is31fl3235a_led_set_brightness(dev, led, 100);
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+	const struct is31fl3235a_cfg *cfg = dev->config;
+#endif
+	struct is31fl3235a_data *data = dev->data;
+	struct is31fl3235a_snapshot *snap = &data->snap;
+
+	memcpy(snap->pwm.b, data->pwm_cache, sizeof(snap->pwm.b));
+#ifdef CONFIG_LED_IS31FL3235A_COMPOSITOR
+	memcpy(snap->layer, data->layer, sizeof(snap->layer));
+	memcpy(snap->alpha, data->alpha, sizeof(snap->alpha));
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	snap->blink_off = data->blink_off;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+	memcpy(snap->eff_gain, data->eff_gain, sizeof(snap->eff_gain));
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+	snap->num_matrices = 0;
+	for (uint32_t bits = data->matrix_leds; bits != 0U; bits &= bits - 1U) {
+		snap->matrix[snap->num_matrices++] = cfg->matrices[find_lsb_set(bits) - 1];
+	}
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_DIMMER
+	snap->master = data->master;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+	snap->budget_ua = data->budget_ua;
+#endif
 }
 
 /**
- * @brief Turn off LED (standard LED API)
+ * @brief Build the PWM frame shown on the outputs from a snapshot
  *
- * @param dev Pointer to device structure
- * @param led Channel number
- * @return 0 on success, negative errno on error
+ * With the compositor, the layers are blended over the logical values;
+ * blinking channels in their off phase are blanked last. Runs with the
+ * spinlock released.
+ *
+ * @param snap Snapshot taken by is31fl3235a_snapshot_take()
+ * @param pwm Receives the PWM values of all channels
  */
-static int is31fl3235a_led_off(const struct device *dev, uint32_t led)
+static inline void is31fl3235a_snapshot_compose(const struct is31fl3235a_snapshot *snap,
+						union is31fl3235a_frame *pwm)
 {
-	return is31fl3235a_led_set_brightness(dev, led, IS31FL3235A_PWM_MIN);
+	*pwm = snap->pwm;
+#ifdef CONFIG_LED_IS31FL3235A_COMPOSITOR
+	for (int l = 0; l < CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS; l++) {
+		is31fl3235a_frame_blend(pwm, &snap->layer[l], &snap->alpha[l]);
+	}
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_frame_clear(pwm, snap->blink_off);
+#endif
 }
 
-/* Standard LED driver API */
-static const struct led_driver_api is31fl3235a_led_api = {
-	.set_brightness = is31fl3235a_led_set_brightness,
-	.write_channels = is31fl3235a_led_write_channels,
-	.on = is31fl3235a_led_on,
-	.off = is31fl3235a_led_off,
-};
-
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
 /**
- * @brief Set current scaling for a channel (extended API)
+ * @brief Move the changes staged in partitions into the shadow
+ *
+ * Called by the flusher with the device spinlock held. Each partition
+ * lock is taken only for the copy, so partition writers contend with
+ * the flusher briefly and never with each other.
+ *
+ * @param data Driver data
+ * @param part_seq Receives the sequence number merged from each partition
  */
-int is31fl3235a_set_current_scale(const struct device *dev,
-				   uint8_t channel,
-				   enum is31fl3235a_current_scale scale)
+static void is31fl3235a_merge_partitions(struct is31fl3235a_data *data,
+					 uint32_t *part_seq)
 {
-	struct is31fl3235a_data *data = dev->data;
-	uint8_t ctrl_val;
-	int ret;
+	for (int i = 0; i < CONFIG_LED_IS31FL3235A_PARTITION_COUNT; i++) {
+		struct is31fl3235a_partition *part = &data->part[i];
+		k_spinlock_key_t key = k_spin_lock(&part->lock);
 
-	if (channel >= IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Invalid channel %u", channel);
-		return -EINVAL;
-	}
+		for (uint32_t bits = part->dirty; bits != 0U; bits &= bits - 1U) {
+			uint32_t ch = find_lsb_set(bits) - 1;
 
-	if (scale > IS31FL3235A_SCALE_1_4X) {
-		LOG_ERR("Invalid scale %u", scale);
-		return -EINVAL;
+			data->pwm_cache[ch] = part->pwm[ch];
+		}
+		if (part->dirty != 0U) {
+			data->pwm_dirty |= part->dirty;
+			data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+			part->dirty = 0;
+		}
+		part_seq[i] = part->seq;
+		k_spin_unlock(&part->lock, key);
 	}
+}
+#endif /* CONFIG_LED_IS31FL3235A_PARTITIONS */
 
-	k_mutex_lock(&data->lock, K_FOREVER);
-
-	/* Read cached control register value */
-	ctrl_val = data->ctrl_cache[channel];
-
-	/* Clear scale bits and set new value */
-	ctrl_val &= ~IS31FL3235A_CTRL_SL_MASK;
-	ctrl_val |= (scale << IS31FL3235A_CTRL_SL_SHIFT);
-
-	/* Write to control register */
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_CTRL_REG(channel), ctrl_val);
-	if (ret < 0) {
-		goto unlock;
-	}
+#ifdef CONFIG_LED_IS31FL3235A_RETAINED_STATE
+/**
+ * @brief Record the state just written to the chip in retained RAM
+ *
+ * @param dev Pointer to device structure
+ * @param pwm Logical PWM values for all channels (pwm_cache)
+ * @param ctrl Control register values for all channels
+ * @param sw_shutdown Software shutdown requested by the application
+ * @param global_enable Global LED output enable state
+ */
+static void is31fl3235a_save_retained(const struct device *dev,
+				      const uint8_t *pwm,
+				      const uint8_t *ctrl,
+				      bool sw_shutdown,
+				      bool global_enable)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	struct is31fl3235a_retained *retained = cfg->retained;
+
+	retained->magic = IS31FL3235A_RETAINED_MAGIC;
+	memcpy(retained->pwm, pwm, sizeof(retained->pwm));
+	memcpy(retained->ctrl, ctrl, sizeof(retained->ctrl));
+	retained->flags = (sw_shutdown ? IS31FL3235A_RETAINED_SW_SHUTDOWN : 0) |
+			  (global_enable ? IS31FL3235A_RETAINED_GLOBAL_ENABLE : 0);
+	retained->crc = crc32_ieee((const uint8_t *)retained,
+				   offsetof(struct is31fl3235a_retained, crc));
+}
 
-	/* Update cache */
-	data->ctrl_cache[channel] = ctrl_val;
+/**
+ * @brief Load the shadow from retained RAM after a warm reboot
+ *
+ * @param dev Pointer to device structure
+ * @return true if a valid retained state was loaded into the shadow
+ */
+static bool is31fl3235a_load_retained(const struct device *dev)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	struct is31fl3235a_data *data = dev->data;
+	const struct is31fl3235a_retained *retained = cfg->retained;
 
-	/* Trigger update */
-	ret = is31fl3235a_trigger_update(dev);
-	if (ret < 0) {
-		goto unlock;
+	if (retained->magic != IS31FL3235A_RETAINED_MAGIC ||
+	    retained->crc != crc32_ieee((const uint8_t *)retained,
+					offsetof(struct is31fl3235a_retained, crc))) {
+		return false;
 	}
 
-	LOG_DBG("Set channel %u current scale to %u", channel, scale);
+	memcpy(data->pwm_cache, retained->pwm, sizeof(data->pwm_cache));
+	memcpy(data->ctrl_cache, retained->ctrl, sizeof(data->ctrl_cache));
+	data->sw_shutdown = (retained->flags & IS31FL3235A_RETAINED_SW_SHUTDOWN) != 0U;
+	data->global_enable = (retained->flags & IS31FL3235A_RETAINED_GLOBAL_ENABLE) != 0U;
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+	return true;
 }
+#endif /* CONFIG_LED_IS31FL3235A_RETAINED_STATE */
 
 /**
- * @brief Enable or disable a channel (extended API)
+ * @brief Multiply two 0-255 values as fractions of 255, rounded
  */
-int is31fl3235a_channel_enable(const struct device *dev,
-				uint8_t channel,
-				bool enable)
+static inline uint8_t is31fl3235a_scale8(uint8_t a, uint8_t b)
 {
-	struct is31fl3235a_data *data = dev->data;
-	uint8_t ctrl_val;
-	int ret;
+	uint16_t x = (uint16_t)a * b + 128U;
+
+	return (x + (x >> 8)) >> 8;
+}
+
+/**
+ * @brief Find the red, green and blue channels of an LED
+ *
+ * @param info LED description
+ * @param ch Output: red, green and blue channel numbers
+ * @return true if the LED has all three components
+ */
+static bool is31fl3235a_rgb_channels(const struct led_info *info, uint8_t *ch)
+{
+	uint8_t found = 0;
+
+	for (uint8_t c = 0; c < info->num_colors; c++) {
+		uint8_t idx;
+
+		switch (info->color_mapping[c]) {
+		case LED_COLOR_ID_RED:
+			idx = 0;
+			break;
+		case LED_COLOR_ID_GREEN:
+			idx = 1;
+			break;
+		case LED_COLOR_ID_BLUE:
+			idx = 2;
+			break;
+		default:
+			continue;
+		}
+		ch[idx] = info->index + c;
+		found |= BIT(idx);
+	}
+
+	return found == BIT_MASK(3);
+}
+
+#ifdef CONFIG_LED_IS31FL3235A_GAMMA
+/* round(255 * (i / 255)^2.2) */
+static const uint8_t is31fl3235a_gamma[256] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+	  3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+	  6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+	 12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+	 20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+	 30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+	 42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+	 56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+	 73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+	 91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+	113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+	137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+	163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+	192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+	223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+/**
+ * @brief Recompute the per-channel gains used by the render stage
+ *
+ * Folds the master dimmer into the calibration gains so both cost a
+ * single multiplication per channel. Called with the shadow spinlock held.
+ *
+ * @param data Device data
+ */
+static void is31fl3235a_update_gain(struct is31fl3235a_data *data)
+{
+	uint32_t master = IS31FL3235A_GAIN_UNITY;
+
+#ifdef CONFIG_LED_IS31FL3235A_DIMMER
+	master = is31fl3235a_q8(data->master);
+#endif
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		data->eff_gain[i] = ((uint32_t)data->gain[i] * master + 128U) >> 8;
+	}
+}
+
+/**
+ * @brief Multiply every channel of a frame by its gain, saturating
+ */
+static inline void is31fl3235a_apply_gain(const struct is31fl3235a_snapshot *snap,
+					  union is31fl3235a_frame *frame)
+{
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		uint32_t v = ((uint32_t)frame->b[i] * snap->eff_gain[i] + 128U) >> 8;
+
+		frame->b[i] = MIN(v, 255U);
+	}
+}
+#endif /* CONFIG_LED_IS31FL3235A_CALIBRATION */
+
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+/**
+ * @brief Apply the color matrices of all RGB LEDs that have one
+ */
+static void is31fl3235a_apply_matrices(const struct is31fl3235a_snapshot *snap,
+				       union is31fl3235a_frame *frame)
+{
+	for (int i = 0; i < snap->num_matrices; i++) {
+		const struct is31fl3235a_color_matrix *mat = &snap->matrix[i];
+		int32_t in[3] = {
+			frame->b[mat->ch[0]], frame->b[mat->ch[1]], frame->b[mat->ch[2]],
+		};
+
+		for (int row = 0; row < 3; row++) {
+			int32_t acc = mat->m[row * 3 + 0] * in[0] +
+				      mat->m[row * 3 + 1] * in[1] +
+				      mat->m[row * 3 + 2] * in[2];
+
+			frame->b[mat->ch[row]] = acc <= 0 ? 0 : MIN((acc + 128) >> 8, 255);
+		}
+	}
+}
+#endif /* CONFIG_LED_IS31FL3235A_COLOR_MATRIX */
+
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+/* 1 / (SL + 1) for each current-scale setting, Q16 */
+static const uint32_t is31fl3235a_sl_recip[] = { 65536, 32768, 21845, 16384 };
+
+/**
+ * @brief Scale a rendered frame down to the total current budget
+ *
+ * Estimates each channel's current as IMAX / scale * PWM / 255 for
+ * enabled outputs, and if the sum exceeds the budget scales every channel
+ * by the same factor, rounding down so the result stays within it.
+ * Called by the flusher with the spinlock released.
+ *
+ * @param data Device data
+ * @param ctrl Control register values for all channels
+ * @param global_enable Global LED output enable state
+ * @param frame PWM values for all channels, scaled in place
+ */
+static void is31fl3235a_limit_current(struct is31fl3235a_data *data,
+				      const uint8_t *ctrl,
+				      bool global_enable,
+				      union is31fl3235a_frame *frame)
+{
+	/* Sum of PWM * channel current, in uA * 255; 64 bits for any imax */
+	uint64_t total = 0;
+	uint64_t limit;
+	uint32_t factor;
+
+	if (global_enable) {
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			uint8_t sl;
+
+			if ((ctrl[i] & IS31FL3235A_CTRL_OUT_ENABLE) == 0U) {
+				continue;
+			}
+			sl = (ctrl[i] & IS31FL3235A_CTRL_SL_MASK) >> IS31FL3235A_CTRL_SL_SHIFT;
+			total += frame->b[i] *
+				 (((uint64_t)data->imax_ua[i] * is31fl3235a_sl_recip[sl]) >> 16);
+		}
+	}
+
+	limit = (uint64_t)data->snap.budget_ua * 255U;
+	if (data->snap.budget_ua == 0U || total <= limit) {
+		data->current_ua = (uint32_t)(total / 255U);
+		return;
+	}
+
+	/* Q8 factor below 1.0; a single division per limited frame */
+	factor = (uint32_t)((limit << 8) / total);
+	is31fl3235a_frame_scale_floor(frame, factor);
+	data->current_ua = (uint32_t)(((total * factor) >> 8) / 255U);
+}
+#endif /* CONFIG_LED_IS31FL3235A_CURRENT_LIMIT */
+
+#ifdef IS31FL3235A_RENDER
+/**
+ * @brief Compute the PWM values written to the chip from logical values
+ *
+ * Runs the stages enabled in Kconfig over the whole frame:
+ *
+ * 1. gamma correction and per-channel gain (calibration with the master
+ *    dimmer folded in), fused in one pass; the gain moves after step 2
+ *    when color matrices are enabled, since they mix channels
+ * 2. color matrices of the RGB LEDs that have one
+ * 3. master dimmer without calibration and the current limiter, which
+ *    apply one factor to every channel and run word-parallel
+ *
+ * Channel remapping is left to the flush, which also has to permute the
+ * control registers and dirty bitmaps. Works from the parameters in
+ * data->snap, so it runs with the shadow spinlock released.
+ *
+ * @param dev Pointer to device structure
+ * @param in Logical PWM values for all channels
+ * @param ctrl Control register values for all channels
+ * @param global_enable Global LED output enable state
+ * @param out Output: PWM values to write for all channels
+ */
+static void is31fl3235a_render(const struct device *dev,
+			       const uint8_t *in,
+			       const uint8_t *ctrl,
+			       bool global_enable,
+			       union is31fl3235a_frame *out)
+{
+	struct is31fl3235a_data *data = dev->data;
+	const struct is31fl3235a_snapshot *snap = &data->snap;
+
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		uint32_t v = in[i];
+
+#ifdef CONFIG_LED_IS31FL3235A_GAMMA
+		v = is31fl3235a_gamma[v];
+#endif
+#if defined(CONFIG_LED_IS31FL3235A_CALIBRATION) && \
+	!defined(CONFIG_LED_IS31FL3235A_COLOR_MATRIX)
+		v = MIN(((uint32_t)v * snap->eff_gain[i] + 128U) >> 8, 255U);
+#endif
+		out->b[i] = v;
+	}
+
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+	is31fl3235a_apply_matrices(snap, out);
+	is31fl3235a_apply_gain(snap, out);
+#endif
+
+#if defined(CONFIG_LED_IS31FL3235A_DIMMER) && !defined(CONFIG_LED_IS31FL3235A_CALIBRATION)
+	is31fl3235a_frame_scale(out, is31fl3235a_q8(snap->master));
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+	is31fl3235a_limit_current(data, ctrl, global_enable, out);
+#else
+	ARG_UNUSED(ctrl);
+	ARG_UNUSED(global_enable);
+#endif
+	ARG_UNUSED(snap);
+}
+#endif /* IS31FL3235A_RENDER */
+
+#ifdef CONFIG_LED_IS31FL3235A_REMAP
+/**
+ * @brief Route logical channels to the physical outputs
+ *
+ * @param map Physical output of each logical channel
+ * @param in Values indexed by logical channel
+ * @param out Output: values indexed by physical output
+ * @param dirty Bitmap of dirty logical channels
+ * @return Bitmap of dirty physical outputs
+ */
+static uint32_t is31fl3235a_remap(const uint8_t *map,
+				  const uint8_t *in,
+				  uint8_t *out,
+				  uint32_t dirty)
+{
+	uint32_t phys_dirty = 0;
+
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		out[map[i]] = in[i];
+		if (dirty & BIT(i)) {
+			phys_dirty |= BIT(map[i]);
+		}
+	}
+
+	return phys_dirty;
+}
+#endif /* CONFIG_LED_IS31FL3235A_REMAP */
+
+/**
+ * @brief Write everything dirty in the shadow to the chip
+ *
+ * Only one thread flushes at a time. If a flush that started after the
+ * caller's modification has already completed, its result is returned
+ * without touching the bus. On failure the written ranges are marked
+ * dirty again so the next flush retries them.
+ *
+ * @param dev Pointer to device structure
+ * @param seq Sequence number returned when staging the caller's change
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_flush(const struct device *dev, uint32_t seq)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	struct is31fl3235a_data *data = dev->data;
+	union is31fl3235a_frame pwm;
+	uint8_t ctrl[IS31FL3235A_NUM_CHANNELS];
+	const uint8_t *out = pwm.b;
+	const uint8_t *ctrl_out = ctrl;
+#ifdef IS31FL3235A_RENDER
+	union is31fl3235a_frame rendered;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_REMAP
+	uint8_t phys_pwm[IS31FL3235A_NUM_CHANNELS];
+	uint8_t phys_ctrl[IS31FL3235A_NUM_CHANNELS];
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
+	uint32_t part_seq[CONFIG_LED_IS31FL3235A_PARTITION_COUNT];
+#endif
+	uint32_t pwm_dirty, ctrl_dirty, snap_seq;
+	uint32_t pwm_out_dirty, ctrl_out_dirty;
+	uint8_t sync;
+	bool shutdown, sw_shutdown, global_enable;
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+	bool held = false;
+#endif
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	k_mutex_lock(&data->bus_lock, K_FOREVER);
+
+	if (is31fl3235a_seq_done(data->flushed_seq, seq)) {
+		ret = data->flush_ret;
+		goto unlock;
+	}
+
+	if (data->bus_suspended || !data->initialized) {
+		/* Chip is down or not up yet; the shadow is replayed later */
+		goto unlock;
+	}
+
+	/* Take a consistent snapshot of the shadow */
+	key = k_spin_lock(&data->lock);
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
+	is31fl3235a_merge_partitions(data, part_seq);
+#endif
+	is31fl3235a_snapshot_take(dev);
+	sw_shutdown = data->sw_shutdown;
+	shutdown = sw_shutdown || data->pm_suspended;
+	pwm_dirty = data->pwm_dirty;
+	ctrl_dirty = data->ctrl_dirty;
+	sync = data->sync_flags;
+	memcpy(ctrl, data->ctrl_cache, sizeof(ctrl));
+	global_enable = data->global_enable;
+	snap_seq = data->seq;
+	data->pwm_dirty = 0;
+	data->ctrl_dirty = 0;
+	data->sync_flags = 0;
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+	if (data->latch_hold) {
+		/* Writing either would overwrite or latch the preloaded frame */
+		data->pwm_dirty = pwm_dirty;
+		data->sync_flags = sync & IS31FL3235A_SYNC_UPDATE;
+		pwm_dirty = 0;
+		sync &= ~IS31FL3235A_SYNC_UPDATE;
+		held = true;
+	}
+	if (sync & IS31FL3235A_SYNC_PRELOAD) {
+		/* This flush writes the preloaded frame; its update waits */
+		data->latch_hold = true;
+		data->sync_flags |= sync & IS31FL3235A_SYNC_UPDATE;
+		sync &= ~IS31FL3235A_SYNC_UPDATE;
+	}
+	if (sync & IS31FL3235A_SYNC_LATCH) {
+		/* The held writes follow with the next flush */
+		data->latch_hold = false;
+	}
+#endif
+	k_spin_unlock(&data->lock, key);
+
+	/* Blend and render the copy with the spinlock released */
+	is31fl3235a_snapshot_compose(&data->snap, &pwm);
+#ifdef CONFIG_LED_IS31FL3235A_AUTO_IDLE
+	if (data->idle_shutdown && !is31fl3235a_frame_is_dark(pwm.b, global_enable)) {
+		/* Something lit up again: wake after the new frame is written */
+		data->idle_shutdown = false;
+		sync |= IS31FL3235A_SYNC_SHUTDOWN;
+	}
+	shutdown = shutdown || data->idle_shutdown;
+#endif
+#ifdef IS31FL3235A_RENDER
+	is31fl3235a_render(dev, pwm.b, ctrl, global_enable, &rendered);
+	out = rendered.b;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+	/* The limiter may rescale channels that were not modified */
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+	/* Nothing is written while held, so the cache stays as on the chip */
+	if (!held)
+#endif
+	{
+		pwm_dirty |= is31fl3235a_frame_diff(&rendered, &data->out_cache);
+		data->out_cache = rendered;
+	}
+#endif
+
+	pwm_out_dirty = pwm_dirty;
+	ctrl_out_dirty = ctrl_dirty;
+#ifdef CONFIG_LED_IS31FL3235A_REMAP
+	if (cfg->channel_map != NULL) {
+		pwm_out_dirty = is31fl3235a_remap(cfg->channel_map, out, phys_pwm,
+						  pwm_dirty);
+		ctrl_out_dirty = is31fl3235a_remap(cfg->channel_map, ctrl, phys_ctrl,
+						   ctrl_dirty);
+		out = phys_pwm;
+		ctrl_out = phys_ctrl;
+	}
+#endif
+
+	ret = is31fl3235a_write_block(dev, IS31FL3235A_REG_PWM_BASE, out, pwm_out_dirty);
+	if (ret < 0) {
+		goto out;
+	}
+
+	ret = is31fl3235a_write_block(dev, IS31FL3235A_REG_CTRL_BASE, ctrl_out,
+				      ctrl_out_dirty);
+	if (ret < 0) {
+		goto out;
+	}
+
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+	if (sync & IS31FL3235A_SYNC_LATCH) {
+		sync |= IS31FL3235A_SYNC_UPDATE;
+	}
+#endif
+	if (sync & IS31FL3235A_SYNC_UPDATE) {
+		ret = is31fl3235a_write_reg(dev, IS31FL3235A_REG_UPDATE,
+					    IS31FL3235A_UPDATE_TRIGGER);
+		if (ret < 0) {
+			goto out;
+		}
+	}
+
+	if (sync & (IS31FL3235A_SYNC_GLOBAL | IS31FL3235A_SYNC_FREQ)) {
+		/* Global control and frequency are adjacent: one burst covers both */
+		uint8_t regs[2] = {
+			/* G_EN bit: 0 = normal operation, 1 = shutdown all LEDs */
+			global_enable ? IS31FL3235A_GLOBAL_CTRL_NORMAL :
+					IS31FL3235A_GLOBAL_CTRL_SHUTDOWN,
+			cfg->pwm_freq_22khz ? IS31FL3235A_FREQ_22KHZ :
+					      IS31FL3235A_FREQ_3KHZ,
+		};
+		uint8_t first = (sync & IS31FL3235A_SYNC_GLOBAL) ? 0 : 1;
+		uint8_t last = (sync & IS31FL3235A_SYNC_FREQ) ? 1 : 0;
+
+		ret = is31fl3235a_write_buffer(dev, IS31FL3235A_REG_GLOBAL_CTRL + first,
+					       &regs[first], last - first + 1);
+		if (ret < 0) {
+			goto out;
+		}
+	}
+
+	if (sync & IS31FL3235A_SYNC_SHUTDOWN) {
+		ret = is31fl3235a_write_reg(dev, IS31FL3235A_REG_SHUTDOWN,
+					    shutdown ? IS31FL3235A_SHUTDOWN_MODE :
+						       IS31FL3235A_SHUTDOWN_NORMAL);
+	}
+
+out:
+	if (ret < 0) {
+		/* Shadow still holds the latest values; retry on next flush */
+		key = k_spin_lock(&data->lock);
+		data->pwm_dirty |= pwm_dirty;
+		data->ctrl_dirty |= ctrl_dirty;
+		data->sync_flags |= sync;
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+		if (sync & IS31FL3235A_SYNC_PRELOAD) {
+			/* Not preloaded after all: the retry holds again */
+			data->latch_hold = false;
+		}
+#endif
+		k_spin_unlock(&data->lock, key);
+	}
+#ifdef CONFIG_LED_IS31FL3235A_RETAINED_STATE
+	if (ret == 0 && (pwm_dirty | ctrl_dirty | sync) != 0U) {
+		/* Retained RAM restores pwm_cache: keep layers and blinking out of it */
+		is31fl3235a_save_retained(dev, data->snap.pwm.b, ctrl, sw_shutdown,
+					  global_enable);
+	}
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_AUTO_IDLE
+	if (ret == 0 && !shutdown) {
+		if (is31fl3235a_frame_is_dark(pwm.b, global_enable)) {
+			/* Starts the idle timer only if not already running */
+			k_work_schedule(&data->idle_work,
+					K_MSEC(CONFIG_LED_IS31FL3235A_AUTO_IDLE_TIMEOUT_MS));
+		} else {
+			k_work_cancel_delayable(&data->idle_work);
+		}
+	}
+#endif
+
+	data->flushed_seq = snap_seq;
+	data->flush_ret = ret;
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
+	for (int i = 0; i < CONFIG_LED_IS31FL3235A_PARTITION_COUNT; i++) {
+		data->part[i].flushed_seq = part_seq[i];
+		data->part[i].flush_ret = ret;
+	}
+#endif
+
+unlock:
+	k_mutex_unlock(&data->bus_lock);
+	return ret;
+}
+
+/**
+ * @brief Stage PWM values in the shadow
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number
+ * @param num_channels Number of consecutive channels
+ * @param buf PWM values (0-255)
+ * @param sync Additional IS31FL3235A_SYNC_* flags to raise
+ * @return Sequence number of the modification
+ */
+static uint32_t is31fl3235a_stage_pwm(const struct device *dev,
+				      uint32_t start_channel,
+				      uint32_t num_channels,
+				      const uint8_t *buf,
+				      uint8_t sync)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	key = k_spin_lock(&data->lock);
+	memcpy(&data->pwm_cache[start_channel], buf, num_channels);
+	data->pwm_dirty |= is31fl3235a_range_mask(start_channel, num_channels);
+	data->sync_flags |= sync;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	return seq;
+}
+
+/**
+ * @brief Stage scattered PWM values in the shadow
+ *
+ * @param dev Pointer to device structure
+ * @param frame PWM values for all channels, indexed by channel
+ * @param mask Bitmap of channels to take from @p frame
+ * @param sync Additional IS31FL3235A_SYNC_* flags to raise
+ * @return Sequence number of the modification
+ */
+static uint32_t is31fl3235a_stage_pwm_masked(const struct device *dev,
+					     const uint8_t *frame,
+					     uint32_t mask,
+					     uint8_t sync)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	key = k_spin_lock(&data->lock);
+	for (uint32_t bits = mask; bits != 0U; bits &= bits - 1U) {
+		uint32_t ch = find_lsb_set(bits) - 1;
+
+		data->pwm_cache[ch] = frame[ch];
+	}
+	data->pwm_dirty |= mask;
+	data->sync_flags |= sync;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	return seq;
+}
+
+/**
+ * @brief Stage control register bits in the shadow
+ *
+ * Bits outside @p mask keep their cached value, so this is a
+ * read-modify-write of the control registers done under the spinlock.
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number
+ * @param num_channels Number of consecutive channels
+ * @param mask Control register bits to modify
+ * @param bits New values for the bits in @p mask, one per channel
+ * @param sync Additional IS31FL3235A_SYNC_* flags to raise
+ * @return Sequence number of the modification
+ */
+static uint32_t is31fl3235a_stage_ctrl(const struct device *dev,
+				       uint32_t start_channel,
+				       uint32_t num_channels,
+				       uint8_t mask,
+				       const uint8_t *bits,
+				       uint8_t sync)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	key = k_spin_lock(&data->lock);
+	for (uint32_t i = 0; i < num_channels; i++) {
+		uint8_t *ctrl = &data->ctrl_cache[start_channel + i];
+
+		*ctrl = (*ctrl & ~mask) | (bits[i] & mask);
+	}
+	data->ctrl_dirty |= is31fl3235a_range_mask(start_channel, num_channels);
+	data->sync_flags |= sync;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	return seq;
+}
+
+/**
+ * @brief Raise IS31FL3235A_SYNC_* flags in the shadow
+ *
+ * @param dev Pointer to device structure
+ * @param sync Flags to raise
+ * @return Sequence number of the modification
+ */
+static uint32_t is31fl3235a_stage_sync(const struct device *dev, uint8_t sync)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	key = k_spin_lock(&data->lock);
+	data->sync_flags |= sync;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	return seq;
+}
+
+/**
+ * @brief Check that the device accepts API calls
+ *
+ * With deferred initialization, calls made before the chip is programmed
+ * are staged in the shadow, or rejected when
+ * CONFIG_LED_IS31FL3235A_ASYNC_INIT_EAGAIN is enabled. Once bring-up has
+ * failed for good, calls are rejected rather than staged into a shadow
+ * that is never written.
+ *
+ * @param dev Pointer to device structure
+ * @return 0 if the call may proceed, -ENODEV if bring-up failed,
+ *         -EAGAIN otherwise
+ */
+static inline int is31fl3235a_check_ready(const struct device *dev)
+{
+	const struct is31fl3235a_data *data = dev->data;
+
+#ifdef CONFIG_LED_IS31FL3235A_ASYNC_INIT
+	if (data->boot_stage == IS31FL3235A_BOOT_FAILED) {
+		return -ENODEV;
+	}
+#endif
+
+	if (IS_ENABLED(CONFIG_LED_IS31FL3235A_ASYNC_INIT_EAGAIN) && !data->initialized) {
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+static void is31fl3235a_blink_cancel(const struct device *dev, uint32_t channels);
+#endif
+
+/**
+ * @brief Stage PWM values and flush them
+ *
+ * A steady value ends blinking on the written channels, as on chips with
+ * hardware blink.
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number
+ * @param num_channels Number of consecutive channels
+ * @param buf PWM values (0-255)
+ * @param sync Additional IS31FL3235A_SYNC_* flags to raise
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_write_pwm(const struct device *dev,
+				 uint32_t start_channel,
+				 uint32_t num_channels,
+				 const uint8_t *buf,
+				 uint8_t sync)
+{
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_blink_cancel(dev, is31fl3235a_range_mask(start_channel, num_channels));
+#endif
+
+	return is31fl3235a_flush(dev, is31fl3235a_stage_pwm(dev, start_channel,
+							    num_channels, buf, sync));
+}
+
+/**
+ * @brief Stage control register bits and flush them
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number
+ * @param num_channels Number of consecutive channels
+ * @param mask Control register bits to modify
+ * @param bits New values for the bits in @p mask, one per channel
+ * @param sync Additional IS31FL3235A_SYNC_* flags to raise
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_write_ctrl(const struct device *dev,
+				  uint32_t start_channel,
+				  uint32_t num_channels,
+				  uint8_t mask,
+				  const uint8_t *bits,
+				  uint8_t sync)
+{
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return is31fl3235a_flush(dev, is31fl3235a_stage_ctrl(dev, start_channel,
+							     num_channels, mask,
+							     bits, sync));
+}
+
+/**
+ * @brief Mark the whole shadow dirty so the next flush replays it
+ *
+ * @param dev Pointer to device structure
+ * @return Sequence number of the modification
+ */
+static uint32_t is31fl3235a_stage_restore(const struct device *dev)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	key = k_spin_lock(&data->lock);
+	data->pwm_dirty = IS31FL3235A_ALL_CHANNELS;
+	data->ctrl_dirty = IS31FL3235A_ALL_CHANNELS;
+	/* Keeps a pending scheduled commit's flags */
+	data->sync_flags |= IS31FL3235A_SYNC_ALL;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	return seq;
+}
+
+/**
+ * @brief Replay the whole shadow to the chip
+ *
+ * Rewrites the PWM block, control block, update, global control and
+ * frequency, and shutdown registers in five transactions.
+ *
+ * @param dev Pointer to device structure
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_restore(const struct device *dev)
+{
+	return is31fl3235a_flush(dev, is31fl3235a_stage_restore(dev));
+}
+
+#ifdef CONFIG_LED_IS31FL3235A_AUTO_IDLE
+/**
+ * @brief Enter software shutdown after the outputs stayed dark
+ */
+static void is31fl3235a_idle_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct is31fl3235a_data *data =
+		CONTAINER_OF(dwork, struct is31fl3235a_data, idle_work);
+	union is31fl3235a_frame pwm;
+	k_spinlock_key_t key;
+	bool global_enable;
+	uint32_t seq;
+	int ret;
+
+	/* Hold off flushes so the snapshot and idle_shutdown stay ours */
+	k_mutex_lock(&data->bus_lock, K_FOREVER);
+
+	key = k_spin_lock(&data->lock);
+	is31fl3235a_snapshot_take(data->dev);
+	global_enable = data->global_enable;
+	seq = data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	is31fl3235a_snapshot_compose(&data->snap, &pwm);
+	if (data->idle_shutdown || !is31fl3235a_frame_is_dark(pwm.b, global_enable)) {
+		/* Lit again since the timer was armed */
+		k_mutex_unlock(&data->bus_lock);
+		return;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (data->seq != seq) {
+		/* Changed while composing; its flush rearms the timer if still dark */
+		k_spin_unlock(&data->lock, key);
+		k_mutex_unlock(&data->bus_lock);
+		return;
+	}
+	data->idle_shutdown = true;
+	data->sync_flags |= IS31FL3235A_SYNC_SHUTDOWN;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	ret = is31fl3235a_flush(data->dev, seq);
+	k_mutex_unlock(&data->bus_lock);
+	if (ret < 0) {
+		LOG_WRN("Failed to enter idle shutdown: %d", ret);
+		return;
+	}
+
+	LOG_DBG("Outputs idle, entered software shutdown");
+}
+#endif /* CONFIG_LED_IS31FL3235A_AUTO_IDLE */
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+/**
+ * @brief Timer wheel shared by the blinking channels of all instances
+ *
+ * One slot per tick, visited in turn; a channel sits in the slot of its
+ * next phase change, with the number of full turns still to wait for
+ * phases longer than the wheel. A tick costs one visit of one slot no
+ * matter how many channels blink.
+ */
+struct is31fl3235a_wheel {
+	/** Spinlock protecting the slots and the wheel fields of the entries */
+	struct k_spinlock lock;
+	/** Entries due at each tick of a turn */
+	sys_dlist_t slot[CONFIG_LED_IS31FL3235A_BLINK_WHEEL_SLOTS];
+	/** Slot visited by the latest tick */
+	uint32_t cursor;
+	/** Number of linked entries; the timer runs while nonzero */
+	uint32_t active;
+};
+
+#define IS31FL3235A_WHEEL_SLOT_INIT(n, _)					\
+	SYS_DLIST_STATIC_INIT(&is31fl3235a_wheel.slot[n])
+
+static struct is31fl3235a_wheel is31fl3235a_wheel = {
+	.slot = {
+		LISTIFY(CONFIG_LED_IS31FL3235A_BLINK_WHEEL_SLOTS,
+			IS31FL3235A_WHEEL_SLOT_INIT, (,))
+	},
+};
+
+/* Ticks elapsed and not yet processed by the wheel work */
+static atomic_t is31fl3235a_wheel_ticks;
+
+static void is31fl3235a_wheel_expiry(struct k_timer *timer);
+static void is31fl3235a_wheel_work_handler(struct k_work *work);
+
+static K_TIMER_DEFINE(is31fl3235a_wheel_timer, is31fl3235a_wheel_expiry, NULL);
+static K_WORK_DEFINE(is31fl3235a_wheel_work, is31fl3235a_wheel_work_handler);
+
+/**
+ * @brief Link a blink entry into the slot due after @p ticks ticks
+ *
+ * Must be called with the wheel lock held.
+ *
+ * @param b Blink entry, not linked
+ * @param ticks Ticks until the next phase change (at least 1)
+ */
+static void is31fl3235a_wheel_insert(struct is31fl3235a_blink *b, uint32_t ticks)
+{
+	struct is31fl3235a_wheel *w = &is31fl3235a_wheel;
+
+	b->rounds = (ticks - 1U) / CONFIG_LED_IS31FL3235A_BLINK_WHEEL_SLOTS;
+	sys_dlist_append(&w->slot[(w->cursor + ticks) % CONFIG_LED_IS31FL3235A_BLINK_WHEEL_SLOTS],
+			 &b->node);
+}
+
+/**
+ * @brief Flip the phase of a due channel and link it for the next change
+ *
+ * Must be called with the wheel lock held; nests the device spinlock.
+ *
+ * @param b Blink entry due at the current tick, unlinked
+ */
+static void is31fl3235a_blink_toggle(struct is31fl3235a_blink *b)
+{
+	struct is31fl3235a_data *data = b->dev->data;
+	k_spinlock_key_t key;
+	bool off;
+
+	key = k_spin_lock(&data->lock);
+	data->blink_off ^= BIT(b->channel);
+	off = (data->blink_off & BIT(b->channel)) != 0U;
+	data->pwm_dirty |= BIT(b->channel);
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	data->blink_seq = ++data->seq;
+	data->blink_pending = true;
+	k_spin_unlock(&data->lock, key);
+
+	is31fl3235a_wheel_insert(b, off ? b->off_ticks : b->on_ticks);
+}
+
+/**
+ * @brief Advance the wheel by one tick
+ *
+ * Must be called with the wheel lock held.
+ */
+static void is31fl3235a_wheel_tick(void)
+{
+	struct is31fl3235a_wheel *w = &is31fl3235a_wheel;
+	sys_dlist_t due;
+	sys_dnode_t *node;
+
+	w->cursor = (w->cursor + 1U) % CONFIG_LED_IS31FL3235A_BLINK_WHEEL_SLOTS;
+
+	/* Detach the slot first: entries relinked into it wait a full turn */
+	sys_dlist_init(&due);
+	while ((node = sys_dlist_get(&w->slot[w->cursor])) != NULL) {
+		sys_dlist_append(&due, node);
+	}
+
+	while ((node = sys_dlist_get(&due)) != NULL) {
+		struct is31fl3235a_blink *b = CONTAINER_OF(node, struct is31fl3235a_blink, node);
+
+		if (b->rounds > 0U) {
+			b->rounds--;
+			sys_dlist_append(&w->slot[w->cursor], node);
+			continue;
+		}
+
+		is31fl3235a_blink_toggle(b);
+	}
+}
+
+/**
+ * @brief Count a wheel tick and hand it to the work queue
+ *
+ * Ticks that elapse while the work is still pending are processed
+ * together by its next run.
+ */
+static void is31fl3235a_wheel_expiry(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	atomic_inc(&is31fl3235a_wheel_ticks);
+	k_work_submit(&is31fl3235a_wheel_work);
+}
+
+/**
+ * @brief Process elapsed wheel ticks and flush every touched instance once
+ *
+ * All phase changes of the processed ticks land in the shadows first, so
+ * each chip gets a single flush: its toggled channels in one burst and
+ * one update, however many channels changed phase.
+ */
+static void is31fl3235a_wheel_work_handler(struct k_work *work)
+{
+	atomic_val_t ticks = atomic_set(&is31fl3235a_wheel_ticks, 0);
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(work);
+
+	key = k_spin_lock(&is31fl3235a_wheel.lock);
+	while (ticks-- > 0) {
+		is31fl3235a_wheel_tick();
+	}
+	k_spin_unlock(&is31fl3235a_wheel.lock, key);
+
+	for (size_t i = 0; i < ARRAY_SIZE(is31fl3235a_devices); i++) {
+		const struct device *dev = is31fl3235a_devices[i];
+		struct is31fl3235a_data *data = dev->data;
+		bool pending;
+		uint32_t seq;
+
+		key = k_spin_lock(&data->lock);
+		pending = data->blink_pending;
+		seq = data->blink_seq;
+		data->blink_pending = false;
+		k_spin_unlock(&data->lock, key);
+
+		if (pending) {
+			(void)is31fl3235a_flush(dev, seq);
+		}
+	}
+}
+
+/**
+ * @brief Unlink a channel from the wheel and stage it back in its on phase
+ *
+ * Must be called with the wheel lock held; nests the device spinlock.
+ *
+ * @param dev Pointer to device structure
+ * @param channel Channel number
+ * @return Sequence number of the modification
+ */
+static uint32_t is31fl3235a_blink_unlink(const struct device *dev, uint32_t channel)
+{
+	struct is31fl3235a_data *data = dev->data;
+	struct is31fl3235a_blink *b = &data->blink[channel];
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	if (sys_dnode_is_linked(&b->node)) {
+		sys_dlist_remove(&b->node);
+		if (--is31fl3235a_wheel.active == 0U) {
+			k_timer_stop(&is31fl3235a_wheel_timer);
+		}
+	}
+
+	key = k_spin_lock(&data->lock);
+	if ((data->blink_off & BIT(channel)) != 0U) {
+		data->blink_off &= ~BIT(channel);
+		data->pwm_dirty |= BIT(channel);
+		data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	}
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	return seq;
+}
+
+/**
+ * @brief Stop blinking channels without flushing
+ *
+ * Called by every path that sets a steady value, after the device was
+ * found ready; the caller's next flush writes the steady values.
+ *
+ * @param dev Pointer to device structure
+ * @param channels Bitmap of channels
+ */
+static void is31fl3235a_blink_cancel(const struct device *dev, uint32_t channels)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key = k_spin_lock(&is31fl3235a_wheel.lock);
+
+	for (uint32_t bits = channels; bits != 0U; bits &= bits - 1U) {
+		uint32_t ch = find_lsb_set(bits) - 1;
+
+		if (sys_dnode_is_linked(&data->blink[ch].node)) {
+			(void)is31fl3235a_blink_unlink(dev, ch);
+		}
+	}
+	k_spin_unlock(&is31fl3235a_wheel.lock, key);
+}
+
+/**
+ * @brief Blink a channel in software (standard LED API)
+ *
+ * The channel alternates between its current value, or full brightness
+ * if it is off, and zero. Phase lengths are rounded up to whole wheel
+ * ticks. Both delays zero select the Kconfig default rate; otherwise a
+ * zero @p delay_off keeps the channel on and a zero @p delay_on keeps it
+ * off, both ending blinking.
+ *
+ * @param dev Pointer to device structure
+ * @param led Channel number (0-27)
+ * @param delay_on Time on, in milliseconds
+ * @param delay_off Time off, in milliseconds
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_led_blink(const struct device *dev,
+				  uint32_t led,
+				  uint32_t delay_on,
+				  uint32_t delay_off)
+{
+	struct is31fl3235a_data *data = dev->data;
+	struct is31fl3235a_blink *b;
+	k_spinlock_key_t wkey, key;
+	uint32_t seq;
+	int ret;
+
+	if (led >= IS31FL3235A_NUM_CHANNELS) {
+		LOG_ERR("Invalid channel %u (max %u)", led,
+			IS31FL3235A_NUM_CHANNELS - 1);
+		return -EINVAL;
+	}
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (delay_on == 0U && delay_off == 0U) {
+		/* The LED API leaves the rate to the driver */
+		delay_on = CONFIG_LED_IS31FL3235A_BLINK_DEFAULT_ON_MS;
+		delay_off = CONFIG_LED_IS31FL3235A_BLINK_DEFAULT_OFF_MS;
+	}
+
+	b = &data->blink[led];
+
+	wkey = k_spin_lock(&is31fl3235a_wheel.lock);
+	(void)is31fl3235a_blink_unlink(dev, led);
+
+	key = k_spin_lock(&data->lock);
+	if (delay_on == 0U) {
+		data->pwm_cache[led] = IS31FL3235A_PWM_MIN;
+	} else if (data->pwm_cache[led] == IS31FL3235A_PWM_MIN) {
+		data->pwm_cache[led] = IS31FL3235A_PWM_MAX;
+	}
+	data->pwm_dirty |= BIT(led);
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	if (delay_on != 0U && delay_off != 0U) {
+		b->on_ticks = DIV_ROUND_UP(delay_on, CONFIG_LED_IS31FL3235A_BLINK_TICK_MS);
+		b->off_ticks = DIV_ROUND_UP(delay_off, CONFIG_LED_IS31FL3235A_BLINK_TICK_MS);
+		is31fl3235a_wheel_insert(b, b->on_ticks);
+		if (is31fl3235a_wheel.active++ == 0U) {
+			k_timer_start(&is31fl3235a_wheel_timer,
+				      K_MSEC(CONFIG_LED_IS31FL3235A_BLINK_TICK_MS),
+				      K_MSEC(CONFIG_LED_IS31FL3235A_BLINK_TICK_MS));
+		}
+	}
+	k_spin_unlock(&is31fl3235a_wheel.lock, wkey);
+
+	ret = is31fl3235a_flush(dev, seq);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Channel %u blinking %u ms on, %u ms off", led, delay_on, delay_off);
+
+	return 0;
+}
+#endif /* CONFIG_LED_IS31FL3235A_BLINK */
+
+/**
+ * @brief Set brightness for a single LED channel (standard LED API)
+ *
+ * @param dev Pointer to device structure
+ * @param led Channel number (0-27)
+ * @param value Brightness value (0-100, percentage)
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_led_set_brightness(const struct device *dev,
+					   uint32_t led,
+					   uint8_t value)
+{
+	uint8_t hw_value;
+	int ret;
+
+	if (led >= IS31FL3235A_NUM_CHANNELS) {
+		LOG_ERR("Invalid channel %u (max %u)", led,
+			IS31FL3235A_NUM_CHANNELS - 1);
+		return -EINVAL;
+	}
+
+	if (value > 100) {
+		LOG_ERR("Invalid brightness %u (max 100)", value);
+		return -EINVAL;
+	}
+
+	/* Convert 0-100 percentage to 0-255 hardware value */
+	hw_value = ((uint16_t)value * 255) / 100;
+
+	ret = is31fl3235a_write_pwm(dev, led, 1, &hw_value, IS31FL3235A_SYNC_UPDATE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channel %u brightness to %u%% (hw: %u)", led, value, hw_value);
+
+	return 0;
+}
+
+/**
+ * @brief Write brightness values to multiple consecutive channels (standard LED API)
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number
+ * @param num_channels Number of consecutive channels
+ * @param buf Buffer containing brightness values (0-100, percentage)
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_led_write_channels(const struct device *dev,
+					   uint32_t start_channel,
+					   uint32_t num_channels,
+					   const uint8_t *buf)
+{
+	uint8_t hw_buf[IS31FL3235A_NUM_CHANNELS];
+	int ret;
+
+	ret = is31fl3235a_check_range(start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Validate and convert 0-100 percentage to 0-255 hardware values */
+	for (uint32_t i = 0; i < num_channels; i++) {
+		if (buf[i] > 100) {
+			LOG_ERR("Invalid brightness %u at index %u (max 100)",
+				buf[i], i);
+			return -EINVAL;
+		}
+		hw_buf[i] = ((uint16_t)buf[i] * 255) / 100;
+	}
+
+	ret = is31fl3235a_write_pwm(dev, start_channel, num_channels, hw_buf,
+				    IS31FL3235A_SYNC_UPDATE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channels %u-%u (%u channels)",
+		start_channel, start_channel + num_channels - 1, num_channels);
+
+	return 0;
+}
+
+/**
+ * @brief Turn on LED to maximum brightness (standard LED API)
+ *
+ * @param dev Pointer to device structure
+ * @param led Channel number
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_led_on(const struct device *dev, uint32_t led)
+{
+	return is31fl3235a_led_set_brightness(dev, led, 100);
+}
+
+/**
+ * @brief Turn off LED (standard LED API)
+ *
+ * @param dev Pointer to device structure
+ * @param led Channel number
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_led_off(const struct device *dev, uint32_t led)
+{
+	return is31fl3235a_led_set_brightness(dev, led, IS31FL3235A_PWM_MIN);
+}
+
+/**
+ * @brief Get information about a device tree described LED (standard LED API)
+ *
+ * @param dev Pointer to device structure
+ * @param led Logical LED number (child node index)
+ * @param info Set to the LED's information
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_led_get_info(const struct device *dev,
+				     uint32_t led,
+				     const struct led_info **info)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+
+	if (led >= cfg->num_leds) {
+		LOG_ERR("Invalid LED %u (%u defined)", led, cfg->num_leds);
+		return -EINVAL;
+	}
+
+	*info = &cfg->leds[led];
+
+	return 0;
+}
+
+/**
+ * @brief Set all color components of a multi-color LED (standard LED API)
+ *
+ * The components occupy consecutive channels, so they are written in one
+ * burst followed by a single update.
+ *
+ * @param dev Pointer to device structure
+ * @param led Logical LED number (child node index)
+ * @param num_colors Number of entries in @p color
+ * @param color Component values (0-255), in color-mapping order
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_led_set_color(const struct device *dev,
+				      uint32_t led,
+				      uint8_t num_colors,
+				      const uint8_t *color)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	const struct led_info *info;
+	int ret;
+
+	if (led >= cfg->num_leds) {
+		LOG_ERR("Invalid LED %u (%u defined)", led, cfg->num_leds);
+		return -EINVAL;
+	}
+
+	info = &cfg->leds[led];
+	if (num_colors != info->num_colors) {
+		LOG_ERR("LED %u has %u colors, got %u", led, info->num_colors,
+			num_colors);
+		return -EINVAL;
+	}
+
+	ret = is31fl3235a_write_pwm(dev, info->index, num_colors, color,
+				    IS31FL3235A_SYNC_UPDATE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set LED %u color (%u components)", led, num_colors);
+
+	return 0;
+}
+
+/* Standard LED driver API */
+static const struct led_driver_api is31fl3235a_led_api = {
+	.get_info = is31fl3235a_led_get_info,
+	.set_color = is31fl3235a_led_set_color,
+	.set_brightness = is31fl3235a_led_set_brightness,
+	.write_channels = is31fl3235a_led_write_channels,
+	.on = is31fl3235a_led_on,
+	.off = is31fl3235a_led_off,
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	.blink = is31fl3235a_led_blink,
+#endif
+};
+
+/**
+ * @brief Set current scaling for a channel (extended API)
+ */
+int is31fl3235a_set_current_scale(const struct device *dev,
+				   uint8_t channel,
+				   enum is31fl3235a_current_scale scale)
+{
+	uint8_t bits;
+	int ret;
+
+	if (channel >= IS31FL3235A_NUM_CHANNELS) {
+		LOG_ERR("Invalid channel %u", channel);
+		return -EINVAL;
+	}
+
+	if (scale > IS31FL3235A_SCALE_1_4X) {
+		LOG_ERR("Invalid scale %u", scale);
+		return -EINVAL;
+	}
+
+	bits = scale << IS31FL3235A_CTRL_SL_SHIFT;
+
+	ret = is31fl3235a_write_ctrl(dev, channel, 1, IS31FL3235A_CTRL_SL_MASK,
+				     &bits, IS31FL3235A_SYNC_UPDATE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channel %u current scale to %u", channel, scale);
+
+	return 0;
+}
+
+/**
+ * @brief Enable or disable a channel (extended API)
+ */
+int is31fl3235a_channel_enable(const struct device *dev,
+				uint8_t channel,
+				bool enable)
+{
+	uint8_t bits;
+	int ret;
 
 	if (channel >= IS31FL3235A_NUM_CHANNELS) {
 		LOG_ERR("Invalid channel %u", channel);
 		return -EINVAL;
 	}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+	bits = enable ? IS31FL3235A_CTRL_OUT_ENABLE : IS31FL3235A_CTRL_OUT_DISABLE;
+
+	ret = is31fl3235a_write_ctrl(dev, channel, 1, IS31FL3235A_CTRL_OUT_ENABLE,
+				     &bits, IS31FL3235A_SYNC_UPDATE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Channel %u %s", channel, enable ? "enabled" : "disabled");
+
+	return 0;
+}
+
+/**
+ * @brief Stage and flush enable states for consecutive channels
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number
+ * @param num_channels Number of consecutive channels
+ * @param enable Array of enable states
+ * @param sync IS31FL3235A_SYNC_* flags to raise along with the change
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_write_enables(const struct device *dev,
+				     uint8_t start_channel,
+				     uint8_t num_channels,
+				     const bool *enable,
+				     uint8_t sync)
+{
+	uint8_t bits[IS31FL3235A_NUM_CHANNELS];
+	int ret;
+
+	ret = is31fl3235a_check_range(start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (uint8_t i = 0; i < num_channels; i++) {
+		bits[i] = enable[i] ? IS31FL3235A_CTRL_OUT_ENABLE :
+				      IS31FL3235A_CTRL_OUT_DISABLE;
+	}
+
+	/* Only the enable bit is touched, preserving current scale settings */
+	return is31fl3235a_write_ctrl(dev, start_channel, num_channels,
+				      IS31FL3235A_CTRL_OUT_ENABLE, bits, sync);
+}
+
+/**
+ * @brief Enable or disable multiple consecutive channels (extended API)
+ */
+int is31fl3235a_channels_enable(const struct device *dev,
+				 uint8_t start_channel,
+				 uint8_t num_channels,
+				 const bool *enable)
+{
+	int ret;
+
+	ret = is31fl3235a_write_enables(dev, start_channel, num_channels, enable,
+					IS31FL3235A_SYNC_UPDATE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channels %u-%u enable states (%u channels)",
+		start_channel, start_channel + num_channels - 1, num_channels);
+
+	return 0;
+}
+
+/**
+ * @brief Enable or disable multiple consecutive channels without triggering update (extended API)
+ */
+int is31fl3235a_channels_enable_no_update(const struct device *dev,
+					   uint8_t start_channel,
+					   uint8_t num_channels,
+					   const bool *enable)
+{
+	int ret;
+
+	ret = is31fl3235a_write_enables(dev, start_channel, num_channels, enable, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channels %u-%u enable states (%u channels, no update)",
+		start_channel, start_channel + num_channels - 1, num_channels);
+
+	return 0;
+}
+
+/**
+ * @brief Software shutdown control (extended API)
+ */
+int is31fl3235a_sw_shutdown(const struct device *dev, bool shutdown)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	key = k_spin_lock(&data->lock);
+	data->sw_shutdown = shutdown;
+	k_spin_unlock(&data->lock, key);
+
+	seq = is31fl3235a_stage_sync(dev, IS31FL3235A_SYNC_SHUTDOWN);
+	ret = is31fl3235a_flush(dev, seq);
+	if (ret < 0) {
+		LOG_ERR("Failed to %s software shutdown: %d",
+			shutdown ? "enter" : "exit", ret);
+		return ret;
+	}
+
+	LOG_INF("Software shutdown %s", shutdown ? "enabled" : "disabled");
+
+	return 0;
+}
+
+/**
+ * @brief Hardware shutdown control via SDB pin (extended API)
+ */
+int is31fl3235a_hw_shutdown(const struct device *dev, bool shutdown)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	struct is31fl3235a_data *data = dev->data;
+	int ret;
+
+	/* Check if SDB pin is configured */
+	if (!cfg->sdb_gpio.port) {
+		LOG_WRN("SDB pin not configured");
+		return -ENOTSUP;
+	}
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Order against any transfer in flight */
+	k_mutex_lock(&data->bus_lock, K_FOREVER);
+
+	/* Set GPIO: low=shutdown, high=normal */
+	ret = gpio_pin_set_dt(&cfg->sdb_gpio, shutdown ? 0 : 1);
+	if (ret < 0) {
+		LOG_ERR("Failed to set SDB pin: %d", ret);
+		goto unlock;
+	}
+
+	data->hw_shutdown = shutdown;
+
+	/* Brief delay for chip to respond */
+	if (!shutdown) {
+		k_msleep(IS31FL3235A_STARTUP_DELAY_MS);
+	}
+
+	LOG_INF("Hardware shutdown %s", shutdown ? "enabled" : "disabled");
+
+unlock:
+	k_mutex_unlock(&data->bus_lock);
+
+	if (ret == 0 && !shutdown) {
+		/* Bring the chip back in sync with the shadow */
+		ret = is31fl3235a_restore(dev);
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Global LED enable/disable via Global Control Register (extended API)
+ *
+ * This uses the Global Control Register (0x4A) to enable or disable all
+ * LED outputs simultaneously without affecting individual channel settings.
+ * Unlike software shutdown, the chip remains fully operational.
+ *
+ * @param dev Pointer to device structure
+ * @param enable true for normal operation, false to shutdown all LEDs
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_global_enable(const struct device *dev, bool enable)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	key = k_spin_lock(&data->lock);
+	data->global_enable = enable;
+	k_spin_unlock(&data->lock, key);
+
+	seq = is31fl3235a_stage_sync(dev, IS31FL3235A_SYNC_GLOBAL);
+	ret = is31fl3235a_flush(dev, seq);
+	if (ret < 0) {
+		LOG_ERR("Failed to set global enable: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Global LED output %s", enable ? "enabled" : "disabled");
+
+	return 0;
+}
+
+/**
+ * @brief Rewrite all chip registers from the driver shadow (extended API)
+ */
+int is31fl3235a_resync(const struct device *dev)
+{
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = is31fl3235a_restore(dev);
+	if (ret < 0) {
+		LOG_ERR("Failed to resync chip state: %d", ret);
+		return ret;
+	}
+
+	LOG_DBG("Chip state resynchronized");
+
+	return 0;
+}
+
+/**
+ * @brief Read I2C transfer outcome counters (extended API)
+ */
+int is31fl3235a_get_i2c_stats(const struct device *dev,
+			      struct is31fl3235a_i2c_stats *stats)
+{
+	struct is31fl3235a_data *data = dev->data;
+
+	k_mutex_lock(&data->bus_lock, K_FOREVER);
+	*stats = data->i2c_stats;
+	k_mutex_unlock(&data->bus_lock);
+
+	return 0;
+}
+
+/**
+ * @brief Manually trigger update (extended API)
+ */
+int is31fl3235a_update(const struct device *dev)
+{
+	uint32_t seq;
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	seq = is31fl3235a_stage_sync(dev, IS31FL3235A_SYNC_UPDATE);
+
+	return is31fl3235a_flush(dev, seq);
+}
+
+/**
+ * @brief Set brightness for a single LED channel without triggering update (extended API)
+ *
+ * @param dev Pointer to device structure
+ * @param led Channel number (0-27)
+ * @param value Brightness value (0-255)
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_set_brightness_no_update(const struct device *dev,
+					  uint32_t led,
+					  uint8_t value)
+{
+	int ret;
+
+	if (led >= IS31FL3235A_NUM_CHANNELS) {
+		LOG_ERR("Invalid channel %u (max %u)", led,
+			IS31FL3235A_NUM_CHANNELS - 1);
+		return -EINVAL;
+	}
+
+	ret = is31fl3235a_write_pwm(dev, led, 1, &value, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channel %u brightness to %u (no update)", led, value);
+
+	return 0;
+}
+
+/**
+ * @brief Write brightness values to multiple consecutive channels without triggering update (extended API)
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number
+ * @param num_channels Number of consecutive channels
+ * @param buf Buffer containing brightness values
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_write_channels_no_update(const struct device *dev,
+					  uint32_t start_channel,
+					  uint32_t num_channels,
+					  const uint8_t *buf)
+{
+	int ret;
+
+	ret = is31fl3235a_check_range(start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = is31fl3235a_write_pwm(dev, start_channel, num_channels, buf, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channels %u-%u (%u channels, no update)",
+		start_channel, start_channel + num_channels - 1, num_channels);
+
+	return 0;
+}
+
+/**
+ * @brief Set brightness for a single LED channel using raw 0-255 value (extended API)
+ *
+ * This function provides direct hardware control with 0-255 PWM values,
+ * equivalent to the standard led_set_brightness() but with full 8-bit resolution.
+ *
+ * @param dev Pointer to device structure
+ * @param led Channel number (0-27)
+ * @param value Brightness value (0-255)
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_set_brightness(const struct device *dev,
+				uint32_t led,
+				uint8_t value)
+{
+	int ret;
+
+	if (led >= IS31FL3235A_NUM_CHANNELS) {
+		LOG_ERR("Invalid channel %u (max %u)", led,
+			IS31FL3235A_NUM_CHANNELS - 1);
+		return -EINVAL;
+	}
+
+	ret = is31fl3235a_write_pwm(dev, led, 1, &value, IS31FL3235A_SYNC_UPDATE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channel %u brightness to %u (raw)", led, value);
+
+	return 0;
+}
+
+/**
+ * @brief Write brightness values to multiple channels using raw 0-255 values (extended API)
+ *
+ * This function provides direct hardware control with 0-255 PWM values,
+ * equivalent to the standard led_write_channels() but with full 8-bit resolution.
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels to write
+ * @param buf Array of brightness values (0-255)
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_write_channels(const struct device *dev,
+				uint32_t start_channel,
+				uint32_t num_channels,
+				const uint8_t *buf)
+{
+	int ret;
+
+	ret = is31fl3235a_check_range(start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = is31fl3235a_write_pwm(dev, start_channel, num_channels, buf,
+				    IS31FL3235A_SYNC_UPDATE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channels %u-%u (%u channels, raw)",
+		start_channel, start_channel + num_channels - 1, num_channels);
+
+	return 0;
+}
+
+/**
+ * @brief Set scattered channels to one raw 0-255 value (extended API)
+ *
+ * @param dev Pointer to device structure
+ * @param channels Bitmap of channels to write
+ * @param value Brightness value (0-255)
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_set_channels(const struct device *dev,
+			     uint32_t channels,
+			     uint8_t value)
+{
+	uint8_t frame[IS31FL3235A_NUM_CHANNELS];
+	int ret;
+
+	if ((channels & ~IS31FL3235A_ALL_CHANNELS) != 0U) {
+		LOG_ERR("Invalid channel mask 0x%08x", channels);
+		return -EINVAL;
+	}
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_blink_cancel(dev, channels);
+#endif
+
+	memset(frame, value, sizeof(frame));
+	ret = is31fl3235a_flush(dev, is31fl3235a_stage_pwm_masked(dev, frame, channels,
+								  IS31FL3235A_SYNC_UPDATE));
+	if (ret < 0) {
+		return ret;
+	}
+
+	LOG_DBG("Set channels 0x%08x to %u (raw)", channels, value);
+
+	return 0;
+}
+
+/**
+ * @brief Convert an HSV color to RGB using integer arithmetic only (extended API)
+ */
+void is31fl3235a_hsv_to_rgb(const struct is31fl3235a_hsv *hsv, uint8_t *rgb)
+{
+	uint16_t h = hsv->h;
+	uint8_t v = hsv->v;
+	uint8_t s = hsv->s;
+	uint8_t f, p, q, t;
+
+	if (h >= IS31FL3235A_HUE_MAX) {
+		h %= IS31FL3235A_HUE_MAX;
+	}
+
+	/* 256 hue steps per sextant: high byte selects it, low byte is the offset */
+	f = h & 0xFFU;
+	p = is31fl3235a_scale8(v, 255U - s);
+	q = is31fl3235a_scale8(v, 255U - is31fl3235a_scale8(s, f));
+	t = is31fl3235a_scale8(v, 255U - is31fl3235a_scale8(s, 255U - f));
+
+	switch (h >> 8) {
+	case 0:
+		rgb[0] = v;
+		rgb[1] = t;
+		rgb[2] = p;
+		break;
+	case 1:
+		rgb[0] = q;
+		rgb[1] = v;
+		rgb[2] = p;
+		break;
+	case 2:
+		rgb[0] = p;
+		rgb[1] = v;
+		rgb[2] = t;
+		break;
+	case 3:
+		rgb[0] = p;
+		rgb[1] = q;
+		rgb[2] = v;
+		break;
+	case 4:
+		rgb[0] = t;
+		rgb[1] = p;
+		rgb[2] = v;
+		break;
+	default:
+		rgb[0] = v;
+		rgb[1] = p;
+		rgb[2] = q;
+		break;
+	}
+}
+
+/**
+ * @brief Set multi-color LEDs from HSV colors in one update (extended API)
+ *
+ * The red, green and blue components of each LED are converted straight
+ * into the shadow; other components (e.g. white) are left unchanged. All
+ * LEDs are flushed together, so the PWM writes coalesce into as few
+ * bursts as the channel layout allows, followed by one update.
+ *
+ * @param dev Pointer to device structure
+ * @param start_led First logical LED number
+ * @param num_leds Number of consecutive logical LEDs
+ * @param hsv One color per LED
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_write_hsv(const struct device *dev,
+			  uint32_t start_led,
+			  uint32_t num_leds,
+			  const struct is31fl3235a_hsv *hsv)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	uint8_t frame[IS31FL3235A_NUM_CHANNELS];
+	uint32_t mask = 0;
+	int ret;
+
+	if (start_led + num_leds > cfg->num_leds || num_leds > cfg->num_leds) {
+		LOG_ERR("LED range %u+%u exceeds %u defined", start_led, num_leds,
+			cfg->num_leds);
+		return -EINVAL;
+	}
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (uint32_t i = 0; i < num_leds; i++) {
+		uint8_t ch[3];
+		uint8_t rgb[3];
+
+		if (!is31fl3235a_rgb_channels(&cfg->leds[start_led + i], ch)) {
+			LOG_ERR("LED %u is not an RGB LED", start_led + i);
+			return -EINVAL;
+		}
+
+		is31fl3235a_hsv_to_rgb(&hsv[i], rgb);
+
+		for (int c = 0; c < 3; c++) {
+			frame[ch[c]] = rgb[c];
+			mask |= BIT(ch[c]);
+		}
+	}
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_blink_cancel(dev, mask);
+#endif
+
+	return is31fl3235a_flush(dev, is31fl3235a_stage_pwm_masked(dev, frame, mask,
+								   IS31FL3235A_SYNC_UPDATE));
+}
+
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+/**
+ * @brief Set calibration gains for consecutive channels (extended API)
+ *
+ * @param dev Pointer to device structure
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels
+ * @param gain Q8 gains (256 = unity), one per channel
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_set_gain(const struct device *dev,
+			 uint32_t start_channel,
+			 uint32_t num_channels,
+			 const uint16_t *gain)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	int ret;
+
+	ret = is31fl3235a_check_range(start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Logical values are unchanged; rewrite them through the new gains */
+	key = k_spin_lock(&data->lock);
+	memcpy(&data->gain[start_channel], gain, num_channels * sizeof(gain[0]));
+	is31fl3235a_update_gain(data);
+	data->pwm_dirty |= is31fl3235a_range_mask(start_channel, num_channels);
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	LOG_DBG("Set gain of channels %u-%u", start_channel,
+		start_channel + num_channels - 1);
+
+	return is31fl3235a_flush(dev, seq);
+}
+#endif /* CONFIG_LED_IS31FL3235A_CALIBRATION */
+
+#ifdef CONFIG_LED_IS31FL3235A_COLOR_MATRIX
+/**
+ * @brief Set or clear the color correction matrix of an RGB LED (extended API)
+ *
+ * @param dev Pointer to device structure
+ * @param led Logical LED number (child node index)
+ * @param matrix Row-major Q8 3x3 matrix, or NULL to remove it
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_set_color_matrix(const struct device *dev,
+				 uint32_t led,
+				 const int16_t *matrix)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	struct is31fl3235a_data *data = dev->data;
+	struct is31fl3235a_color_matrix *mat;
+	k_spinlock_key_t key;
+	uint8_t ch[3];
+	uint32_t seq;
+	int ret;
+
+	if (led >= cfg->num_leds) {
+		LOG_ERR("Invalid LED %u (%u defined)", led, cfg->num_leds);
+		return -EINVAL;
+	}
+
+	if (!is31fl3235a_rgb_channels(&cfg->leds[led], ch)) {
+		LOG_ERR("LED %u is not an RGB LED", led);
+		return -EINVAL;
+	}
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	mat = &cfg->matrices[led];
+
+	key = k_spin_lock(&data->lock);
+	if (matrix != NULL && (data->matrix_leds & BIT(led)) == 0U &&
+	    POPCOUNT(data->matrix_leds) >= IS31FL3235A_MAX_RGB_LEDS) {
+		k_spin_unlock(&data->lock, key);
+		LOG_ERR("No room for another color matrix");
+		return -ENOSPC;
+	}
+	if (matrix != NULL) {
+		memcpy(mat->m, matrix, sizeof(mat->m));
+		memcpy(mat->ch, ch, sizeof(mat->ch));
+		data->matrix_leds |= BIT(led);
+	} else {
+		data->matrix_leds &= ~BIT(led);
+	}
+	data->pwm_dirty |= BIT(ch[0]) | BIT(ch[1]) | BIT(ch[2]);
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	LOG_DBG("%s color matrix of LED %u", matrix != NULL ? "Set" : "Cleared", led);
+
+	return is31fl3235a_flush(dev, seq);
+}
+#endif /* CONFIG_LED_IS31FL3235A_COLOR_MATRIX */
+
+#ifdef CONFIG_LED_IS31FL3235A_DIMMER
+/**
+ * @brief Set the master dimmer level (extended API)
+ *
+ * @param dev Pointer to device structure
+ * @param level Dimmer level (0-255, 255 = no dimming)
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_set_master_brightness(const struct device *dev, uint8_t level)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (data->master == level) {
+		k_spin_unlock(&data->lock, key);
+		return 0;
+	}
+	/* Every output changes: one burst rewrites the whole PWM block */
+	data->master = level;
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+	is31fl3235a_update_gain(data);
+#endif
+	data->pwm_dirty = IS31FL3235A_ALL_CHANNELS;
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	LOG_DBG("Set master brightness to %u", level);
+
+	return is31fl3235a_flush(dev, seq);
+}
+
+/**
+ * @brief Get the master dimmer level (extended API)
+ */
+uint8_t is31fl3235a_get_master_brightness(const struct device *dev)
+{
+	const struct is31fl3235a_data *data = dev->data;
+
+	return data->master;
+}
+#endif /* CONFIG_LED_IS31FL3235A_DIMMER */
+
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+/**
+ * @brief Set the total current budget (extended API)
+ *
+ * @param dev Pointer to device structure
+ * @param budget_ua Budget in microamps, 0 to disable limiting
+ * @return 0 on success, negative errno on error
+ */
+int is31fl3235a_set_current_budget(const struct device *dev, uint32_t budget_ua)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The flush re-renders the frame and writes the channels that moved */
+	key = k_spin_lock(&data->lock);
+	data->budget_ua = budget_ua;
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	LOG_DBG("Set current budget to %u uA", budget_ua);
+
+	return is31fl3235a_flush(dev, seq);
+}
+
+/**
+ * @brief Get the estimated output current of the last frame (extended API)
+ */
+uint32_t is31fl3235a_get_current(const struct device *dev)
+{
+	const struct is31fl3235a_data *data = dev->data;
+
+	return data->current_ua;
+}
+#endif /* CONFIG_LED_IS31FL3235A_CURRENT_LIMIT */
+
+#ifdef CONFIG_LED_IS31FL3235A_FRAMEBUFFER
+/**
+ * @brief Publish the composed channels of the back buffer to the shadow
+ *
+ * Must be called with frame_lock held. The copy happens in one spinlock
+ * section, so a flush sees all of the frame or none of it.
+ *
+ * @param dev Pointer to device structure
+ * @param sync Additional IS31FL3235A_SYNC_* flags to raise
+ * @return Sequence number of the modification
+ */
+static uint32_t is31fl3235a_stage_back(const struct device *dev, uint8_t sync)
+{
+	struct is31fl3235a_data *data = dev->data;
+	uint32_t dirty = (uint32_t)atomic_clear(&data->back_dirty);
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_blink_cancel(dev, dirty);
+#endif
+
+	return is31fl3235a_stage_pwm_masked(dev, data->back.b, dirty, sync);
+}
+
+/**
+ * @brief Compose PWM values into the back buffer (extended API)
+ */
+int is31fl3235a_frame_write(const struct device *dev,
+			    uint32_t start_channel,
+			    uint32_t num_channels,
+			    const uint8_t *buf)
+{
+	struct is31fl3235a_data *data = dev->data;
+	int ret;
+
+	ret = is31fl3235a_check_range(start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(&data->frame_lock, K_FOREVER);
+	memcpy(&data->back.b[start_channel], buf, num_channels);
+	atomic_or(&data->back_dirty, is31fl3235a_range_mask(start_channel, num_channels));
+	k_mutex_unlock(&data->frame_lock);
+
+	return 0;
+}
+
+/**
+ * @brief Read PWM values back from the back buffer (extended API)
+ */
+int is31fl3235a_frame_read(const struct device *dev,
+			   uint32_t start_channel,
+			   uint32_t num_channels,
+			   uint8_t *buf)
+{
+	struct is31fl3235a_data *data = dev->data;
+	int ret;
+
+	ret = is31fl3235a_check_range(start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(&data->frame_lock, K_FOREVER);
+	memcpy(buf, &data->back.b[start_channel], num_channels);
+	k_mutex_unlock(&data->frame_lock);
+
+	return 0;
+}
+
+/**
+ * @brief Lease the back buffer for in-place composition (extended API)
+ */
+int is31fl3235a_frame_lease(const struct device *dev,
+			    k_timeout_t timeout,
+			    uint8_t **frame)
+{
+	struct is31fl3235a_data *data = dev->data;
+	int ret;
+
+	ret = k_mutex_lock(&data->frame_lock, timeout);
+	if (ret < 0) {
+		return -EAGAIN;
+	}
+
+	*frame = data->back.b;
+
+	return 0;
+}
+
+/**
+ * @brief Return a leased back buffer (extended API)
+ */
+int is31fl3235a_frame_release(const struct device *dev, uint32_t dirty)
+{
+	struct is31fl3235a_data *data = dev->data;
+	int ret;
+
+	/* A caller not holding the lease must not mark channels */
+	ret = k_mutex_unlock(&data->frame_lock);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if ((dirty & ~IS31FL3235A_ALL_CHANNELS) != 0U) {
+		/* The lease is returned regardless */
+		LOG_ERR("Invalid channel bitmap 0x%08x", dirty);
+		dirty &= IS31FL3235A_ALL_CHANNELS;
+		ret = -EINVAL;
+	}
+
+	atomic_or(&data->back_dirty, dirty);
+
+	return ret;
+}
+
+/**
+ * @brief Publish the back buffer and write it with one update (extended API)
+ */
+int is31fl3235a_frame_commit(const struct device *dev)
+{
+	struct is31fl3235a_data *data = dev->data;
+	uint32_t seq;
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(&data->frame_lock, K_FOREVER);
+	seq = is31fl3235a_stage_back(dev, IS31FL3235A_SYNC_UPDATE);
+	k_mutex_unlock(&data->frame_lock);
+
+	/* The next frame can be composed while this one is on the bus */
+	return is31fl3235a_flush(dev, seq);
+}
+
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_CLOCK
+/**
+ * @brief Frame clock tick: hand the commit to the work queue
+ */
+static void is31fl3235a_clock_expiry(struct k_timer *timer)
+{
+	struct is31fl3235a_data *data =
+		CONTAINER_OF(timer, struct is31fl3235a_data, clock_timer);
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&data->lock);
+	data->clock_stats.ticks++;
+	if (k_work_submit(&data->clock_work) == 0) {
+		/* The previous tick's commit has not even started */
+		data->clock_stats.missed++;
+	} else {
+		data->clock_tick_cyc = k_cycle_get_32();
+	}
+	k_spin_unlock(&data->lock, key);
+}
+
+/**
+ * @brief Commit the back buffer for the last frame clock tick
+ */
+static void is31fl3235a_clock_work_handler(struct k_work *work)
+{
+	struct is31fl3235a_data *data =
+		CONTAINER_OF(work, struct is31fl3235a_data, clock_work);
+	const struct device *dev = data->dev;
+	k_spinlock_key_t key;
+	uint32_t delay_us, seq;
+	int ret;
+
+	/* Never wait for a composer: its frame goes out on the next tick */
+	if (k_mutex_lock(&data->frame_lock, K_NO_WAIT) < 0) {
+		key = k_spin_lock(&data->lock);
+		data->clock_stats.missed++;
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	if (atomic_get(&data->back_dirty) == 0) {
+		/* Nothing composed since the last frame */
+		k_mutex_unlock(&data->frame_lock);
+		return;
+	}
+
+	seq = is31fl3235a_stage_back(dev, IS31FL3235A_SYNC_UPDATE);
+	k_mutex_unlock(&data->frame_lock);
+
+	key = k_spin_lock(&data->lock);
+	delay_us = k_cyc_to_us_floor32(k_cycle_get_32() - data->clock_tick_cyc);
+	data->clock_stats.frames++;
+	data->clock_jitter_sum_us += delay_us;
+	data->clock_stats.jitter_max_us = MAX(data->clock_stats.jitter_max_us, delay_us);
+	k_spin_unlock(&data->lock, key);
+
+	ret = is31fl3235a_flush(dev, seq);
+	if (ret < 0) {
+		LOG_WRN("Frame clock commit failed: %d", ret);
+	}
+}
+
+/**
+ * @brief Start committing the back buffer at a fixed rate (extended API)
+ */
+int is31fl3235a_frame_clock_start(const struct device *dev, uint32_t fps)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_timeout_t period;
+	k_spinlock_key_t key;
+
+	if (fps == 0U || fps > IS31FL3235A_FRAME_CLOCK_MAX_FPS) {
+		LOG_ERR("Invalid frame rate %u (1-%u)", fps,
+			IS31FL3235A_FRAME_CLOCK_MAX_FPS);
+		return -EINVAL;
+	}
+
+	k_timer_stop(&data->clock_timer);
+
+	key = k_spin_lock(&data->lock);
+	memset(&data->clock_stats, 0, sizeof(data->clock_stats));
+	data->clock_jitter_sum_us = 0;
+	data->clock_start_ms = k_uptime_get();
+	k_spin_unlock(&data->lock, key);
+
+	period = K_USEC(USEC_PER_SEC / fps);
+	k_timer_start(&data->clock_timer, period, period);
+
+	LOG_DBG("Frame clock started at %u fps", fps);
+
+	return 0;
+}
+
+/**
+ * @brief Stop the frame clock (extended API)
+ */
+int is31fl3235a_frame_clock_stop(const struct device *dev)
+{
+	struct is31fl3235a_data *data = dev->data;
+
+	k_timer_stop(&data->clock_timer);
+	k_work_cancel(&data->clock_work);
+
+	return 0;
+}
+
+/**
+ * @brief Read the frame clock statistics (extended API)
+ */
+int is31fl3235a_get_frame_clock_stats(const struct device *dev,
+				      struct is31fl3235a_frame_clock_stats *stats)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	int64_t elapsed_ms;
+	uint64_t jitter_sum_us;
+
+	key = k_spin_lock(&data->lock);
+	*stats = data->clock_stats;
+	jitter_sum_us = data->clock_jitter_sum_us;
+	elapsed_ms = k_uptime_get() - data->clock_start_ms;
+	k_spin_unlock(&data->lock, key);
+
+	stats->rate_mhz = elapsed_ms > 0 ?
+		(uint32_t)((uint64_t)stats->frames * MSEC_PER_SEC * MSEC_PER_SEC / elapsed_ms) : 0;
+	stats->jitter_avg_us = stats->frames > 0U ?
+		(uint32_t)(jitter_sum_us / stats->frames) : 0;
+
+	return 0;
+}
+#endif /* CONFIG_LED_IS31FL3235A_FRAME_CLOCK */
+#endif /* CONFIG_LED_IS31FL3235A_FRAMEBUFFER */
+
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_QUEUE
+/**
+ * @brief Preload the next queued frame and schedule its latch
+ *
+ * Called by the owner of latch_pending. Releases latch_pending when the
+ * queue is empty; the check and the release share the spinlock with
+ * is31fl3235a_queue_frame(), so a frame queued meanwhile is never left
+ * behind.
+ *
+ * @param dev Pointer to device structure
+ */
+static void is31fl3235a_queue_advance(const struct device *dev)
+{
+	struct is31fl3235a_data *data = dev->data;
+	struct is31fl3235a_frame_entry entry;
+	k_spinlock_key_t key;
+	int ret;
+
+	do {
+		key = k_spin_lock(&data->lock);
+		if (k_msgq_num_used_get(&data->queue) == 0U) {
+			data->latch_pending = false;
+			k_spin_unlock(&data->lock, key);
+			return;
+		}
+		k_spin_unlock(&data->lock, key);
+		/* Fails only if the queue was purged in between */
+	} while (k_msgq_get(&data->queue, &entry, K_NO_WAIT) < 0);
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_blink_cancel(dev, IS31FL3235A_ALL_CHANNELS);
+#endif
+	ret = is31fl3235a_flush(dev, is31fl3235a_stage_pwm(dev, 0, IS31FL3235A_NUM_CHANNELS,
+							   entry.pwm,
+							   IS31FL3235A_SYNC_PRELOAD));
+	if (ret < 0) {
+		/* Still dirty: written together with the update at the latch */
+		LOG_WRN("Queued frame preload failed: %d", ret);
+	}
+
+	k_work_reschedule(&data->latch_work, sys_timepoint_timeout(entry.when));
+}
+
+/**
+ * @brief Queue a frame for autonomous playback (extended API)
+ */
+int is31fl3235a_queue_frame(const struct device *dev,
+			    k_timepoint_t when,
+			    const uint8_t *pwm,
+			    k_timeout_t timeout)
+{
+	struct is31fl3235a_data *data = dev->data;
+	struct is31fl3235a_frame_entry entry = { .when = when };
+	k_spinlock_key_t key;
+	bool idle;
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	memcpy(entry.pwm, pwm, sizeof(entry.pwm));
+
+	ret = k_msgq_put(&data->queue, &entry, timeout);
+	if (ret < 0) {
+		return -EAGAIN;
+	}
+
+	key = k_spin_lock(&data->lock);
+	idle = !data->latch_pending;
+	data->latch_pending = true;
+	k_spin_unlock(&data->lock, key);
+
+	if (idle) {
+		/* Start playback; afterwards the latch handler keeps it going */
+		is31fl3235a_queue_advance(dev);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Drop the frames not yet preloaded (extended API)
+ */
+int is31fl3235a_queue_clear(const struct device *dev)
+{
+	struct is31fl3235a_data *data = dev->data;
+
+	k_msgq_purge(&data->queue);
+
+	return 0;
+}
+#endif /* CONFIG_LED_IS31FL3235A_FRAME_QUEUE */
+
+/**
+ * @brief Latch the preloaded frame at its scheduled time
+ */
+static void is31fl3235a_latch_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct is31fl3235a_data *data =
+		CONTAINER_OF(dwork, struct is31fl3235a_data, latch_work);
+	int ret;
+
+	/* PWM writes are held, so this is the 1-byte update write */
+	ret = is31fl3235a_flush(data->dev,
+				is31fl3235a_stage_sync(data->dev, IS31FL3235A_SYNC_LATCH));
+	if (ret < 0) {
+		LOG_WRN("Scheduled update failed: %d", ret);
+	}
+
+	/* Writes held back since the preload go out now */
+	ret = is31fl3235a_flush(data->dev, is31fl3235a_stage_sync(data->dev, 0));
+	if (ret < 0) {
+		LOG_WRN("Flush after scheduled update failed: %d", ret);
+	}
+
+	/*
+	 * Released, or handed to the next queued frame, only now so the
+	 * next preload cannot join this flush
+	 */
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_QUEUE
+	is31fl3235a_queue_advance(data->dev);
+#else
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->latch_pending = false;
+	k_spin_unlock(&data->lock, key);
+#endif
+}
+
+/**
+ * @brief Preload the prepared frame and latch it at a given time (extended API)
+ */
+int is31fl3235a_commit_at(const struct device *dev, k_timepoint_t when)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	int ret;
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (data->latch_pending) {
+		/* Preloading now would overwrite the frame still waiting */
+		k_spin_unlock(&data->lock, key);
+		return -EBUSY;
+	}
+	data->latch_pending = true;
+	k_spin_unlock(&data->lock, key);
+
+	/* Write the frame data now; the update trigger waits for the latch */
+#ifdef CONFIG_LED_IS31FL3235A_FRAMEBUFFER
+	k_mutex_lock(&data->frame_lock, K_FOREVER);
+	seq = is31fl3235a_stage_back(dev, IS31FL3235A_SYNC_PRELOAD);
+	k_mutex_unlock(&data->frame_lock);
+#else
+	seq = is31fl3235a_stage_sync(dev, IS31FL3235A_SYNC_PRELOAD);
+#endif
+
+	ret = is31fl3235a_flush(dev, seq);
+	if (ret < 0) {
+		/* Whether or not a retry preloaded it, nothing will latch it */
+		key = k_spin_lock(&data->lock);
+		data->sync_flags &= ~IS31FL3235A_SYNC_PRELOAD;
+		data->latch_hold = false;
+		data->latch_pending = false;
+		k_spin_unlock(&data->lock, key);
+		return ret;
+	}
 
-	/* Read cached control register value */
-	ctrl_val = data->ctrl_cache[channel];
+	k_work_reschedule(&data->latch_work, sys_timepoint_timeout(when));
 
-	/* Set or clear enable bit */
-	if (enable) {
-		ctrl_val |= IS31FL3235A_CTRL_OUT_ENABLE;
-	} else {
-		ctrl_val &= ~IS31FL3235A_CTRL_OUT_ENABLE;
-	}
+	return 0;
+}
+#endif /* CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT */
 
-	/* Write to control register */
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_CTRL_REG(channel), ctrl_val);
-	if (ret < 0) {
-		goto unlock;
+#ifdef CONFIG_LED_IS31FL3235A_COMPOSITOR
+/**
+ * @brief Stage values into a layer frame and mark the channels dirty
+ *
+ * @param dev Pointer to device structure
+ * @param frame Layer contents or opacity frame to modify
+ * @param start_channel First channel number
+ * @param num_channels Number of consecutive channels
+ * @param buf New values
+ * @return Sequence number of the modification
+ */
+static uint32_t is31fl3235a_stage_layer(const struct device *dev,
+					union is31fl3235a_frame *frame,
+					uint32_t start_channel,
+					uint32_t num_channels,
+					const uint8_t *buf)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+
+	key = k_spin_lock(&data->lock);
+	memcpy(&frame->b[start_channel], buf, num_channels);
+	/* The blend is redone at flush time for the affected channels */
+	data->pwm_dirty |= is31fl3235a_range_mask(start_channel, num_channels);
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+	return seq;
+}
+
+/**
+ * @brief Validate a layer access
+ */
+static int is31fl3235a_check_layer(uint32_t layer,
+				   uint32_t start_channel,
+				   uint32_t num_channels)
+{
+	if (layer >= CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS) {
+		LOG_ERR("Invalid layer %u (max %u)", layer,
+			CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS - 1);
+		return -EINVAL;
 	}
 
-	/* Update cache */
-	data->ctrl_cache[channel] = ctrl_val;
+	return is31fl3235a_check_range(start_channel, num_channels);
+}
+
+/**
+ * @brief Write PWM values into a compositor layer (extended API)
+ */
+int is31fl3235a_layer_write(const struct device *dev,
+			    uint32_t layer,
+			    uint32_t start_channel,
+			    uint32_t num_channels,
+			    const uint8_t *buf)
+{
+	struct is31fl3235a_data *data = dev->data;
+	int ret;
 
-	/* Trigger update */
-	ret = is31fl3235a_trigger_update(dev);
+	ret = is31fl3235a_check_layer(layer, start_channel, num_channels);
 	if (ret < 0) {
-		goto unlock;
+		return ret;
 	}
 
-	LOG_DBG("Channel %u %s", channel, enable ? "enabled" : "disabled");
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
+	}
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+	return is31fl3235a_flush(dev, is31fl3235a_stage_layer(dev, &data->layer[layer],
+							      start_channel,
+							      num_channels, buf));
 }
 
 /**
- * @brief Enable or disable multiple consecutive channels (extended API)
+ * @brief Set the per-channel opacity of a compositor layer (extended API)
  */
-int is31fl3235a_channels_enable(const struct device *dev,
-				 uint8_t start_channel,
-				 uint8_t num_channels,
-				 const bool *enable)
+int is31fl3235a_layer_set_opacity(const struct device *dev,
+				  uint32_t layer,
+				  uint32_t start_channel,
+				  uint32_t num_channels,
+				  const uint8_t *alpha)
 {
 	struct is31fl3235a_data *data = dev->data;
-	uint8_t ctrl_buf[IS31FL3235A_NUM_CHANNELS];
 	int ret;
 
-	if (start_channel >= IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Invalid start channel %u", start_channel);
-		return -EINVAL;
+	ret = is31fl3235a_check_layer(layer, start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
 	}
 
-	if (start_channel + num_channels > IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Channel range %u-%u exceeds maximum %u",
-			start_channel, start_channel + num_channels - 1,
-			IS31FL3235A_NUM_CHANNELS - 1);
-		return -EINVAL;
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
 	}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+	return is31fl3235a_flush(dev, is31fl3235a_stage_layer(dev, &data->alpha[layer],
+							      start_channel,
+							      num_channels, alpha));
+}
+#endif /* CONFIG_LED_IS31FL3235A_COMPOSITOR */
 
-	/* Build control register buffer, preserving current scale settings */
-	for (uint8_t i = 0; i < num_channels; i++) {
-		uint8_t ctrl_val = data->ctrl_cache[start_channel + i];
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
+/**
+ * @brief Flush on behalf of a partition writer
+ *
+ * @param part Partition
+ * @param seq Sequence number returned when staging into @p part
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_partition_flush(struct is31fl3235a_partition *part, uint32_t seq)
+{
+	struct is31fl3235a_data *data = part->dev->data;
+	int ret;
 
-		if (enable[i]) {
-			ctrl_val |= IS31FL3235A_CTRL_OUT_ENABLE;
-		} else {
-			ctrl_val &= ~IS31FL3235A_CTRL_OUT_ENABLE;
-		}
+	/* bus_lock is recursive: keep it across the check and the flush */
+	k_mutex_lock(&data->bus_lock, K_FOREVER);
+	if (is31fl3235a_seq_done(part->flushed_seq, seq)) {
+		/* Another thread's flush already merged the change */
+		ret = part->flush_ret;
+	} else {
+		/* A device sequence number not yet flushed forces a flush */
+		ret = is31fl3235a_flush(part->dev, data->flushed_seq + 1);
+	}
+	k_mutex_unlock(&data->bus_lock);
+
+	return ret;
+}
+
+/**
+ * @brief Get a channel partition of a device (extended API)
+ */
+struct is31fl3235a_partition *is31fl3235a_partition_get(const struct device *dev,
+							 uint32_t index)
+{
+	struct is31fl3235a_data *data = dev->data;
 
-		ctrl_buf[i] = ctrl_val;
+	if (index >= CONFIG_LED_IS31FL3235A_PARTITION_COUNT) {
+		return NULL;
 	}
 
-	/* Write control values to consecutive registers */
-	ret = is31fl3235a_write_buffer(dev, IS31FL3235A_CTRL_REG(start_channel),
-					ctrl_buf, num_channels);
+	return &data->part[index];
+}
+
+/**
+ * @brief Get the channels owned by a partition (extended API)
+ */
+uint32_t is31fl3235a_partition_channels(const struct is31fl3235a_partition *part)
+{
+	return part->mask;
+}
+
+/**
+ * @brief Write PWM values to channels of a partition (extended API)
+ */
+int is31fl3235a_partition_write(struct is31fl3235a_partition *part,
+				uint32_t start_channel,
+				uint32_t num_channels,
+				const uint8_t *buf)
+{
+	k_spinlock_key_t key;
+	uint32_t mask, seq;
+	int ret;
+
+	ret = is31fl3235a_check_range(start_channel, num_channels);
 	if (ret < 0) {
-		goto unlock;
+		return ret;
 	}
 
-	/* Update cache */
-	memcpy(&data->ctrl_cache[start_channel], ctrl_buf, num_channels);
+	mask = is31fl3235a_range_mask(start_channel, num_channels);
+	if ((mask & ~part->mask) != 0U) {
+		LOG_ERR("Channels 0x%08x not owned by the partition", mask & ~part->mask);
+		return -EACCES;
+	}
 
-	/* Trigger update to apply all changes simultaneously */
-	ret = is31fl3235a_trigger_update(dev);
+	ret = is31fl3235a_check_ready(part->dev);
 	if (ret < 0) {
-		goto unlock;
+		return ret;
 	}
 
-	LOG_DBG("Set channels %u-%u enable states (%u channels)",
-		start_channel, start_channel + num_channels - 1, num_channels);
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_blink_cancel(part->dev, mask);
+#endif
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+	key = k_spin_lock(&part->lock);
+	memcpy(&part->pwm[start_channel], buf, num_channels);
+	part->dirty |= mask;
+	seq = ++part->seq;
+	k_spin_unlock(&part->lock, key);
+
+	return is31fl3235a_partition_flush(part, seq);
 }
+#endif /* CONFIG_LED_IS31FL3235A_PARTITIONS */
+
+#ifdef IS31FL3235A_EASING
+/* Built-in easing tables, generated from the closed forms in is31fl3235a_ease.h */
+#define IS31FL3235A_EASE_LUT(pt) { LISTIFY(IS31FL3235A_EASE_POINTS, pt, (,)) }
+
+static const uint16_t is31fl3235a_ease_luts[][IS31FL3235A_EASE_POINTS] = {
+	[IS31FL3235A_EASE_LINEAR] = IS31FL3235A_EASE_LUT(IS31FL3235A_EASE_PT_LINEAR),
+	[IS31FL3235A_EASE_IN_QUAD] = IS31FL3235A_EASE_LUT(IS31FL3235A_EASE_PT_IN_QUAD),
+	[IS31FL3235A_EASE_OUT_QUAD] = IS31FL3235A_EASE_LUT(IS31FL3235A_EASE_PT_OUT_QUAD),
+	[IS31FL3235A_EASE_IN_OUT_QUAD] = IS31FL3235A_EASE_LUT(IS31FL3235A_EASE_PT_IN_OUT_QUAD),
+	[IS31FL3235A_EASE_IN_CUBIC] = IS31FL3235A_EASE_LUT(IS31FL3235A_EASE_PT_IN_CUBIC),
+	[IS31FL3235A_EASE_OUT_CUBIC] = IS31FL3235A_EASE_LUT(IS31FL3235A_EASE_PT_OUT_CUBIC),
+	[IS31FL3235A_EASE_IN_OUT_CUBIC] = IS31FL3235A_EASE_LUT(IS31FL3235A_EASE_PT_IN_OUT_CUBIC),
+	[IS31FL3235A_EASE_SMOOTHSTEP] = IS31FL3235A_EASE_LUT(IS31FL3235A_EASE_PT_SMOOTHSTEP),
+};
+
+BUILD_ASSERT(ARRAY_SIZE(is31fl3235a_ease_luts) == IS31FL3235A_EASE_CUSTOM,
+	     "every built-in easing curve needs a table");
+BUILD_ASSERT(IS31FL3235A_EASE_POINTS == IS31FL3235A_EASE_SEGS + 1,
+	     "easing tables hold one point per segment boundary");
 
 /**
- * @brief Enable or disable multiple consecutive channels without triggering update (extended API)
+ * @brief Check the easing of a transition
+ *
+ * @param ease Easing, or NULL for linear
+ * @return 0 if valid, -EINVAL otherwise
  */
-int is31fl3235a_channels_enable_no_update(const struct device *dev,
-					   uint8_t start_channel,
-					   uint8_t num_channels,
-					   const bool *enable)
+static int is31fl3235a_check_easing(const struct is31fl3235a_easing *ease)
 {
-	struct is31fl3235a_data *data = dev->data;
-	uint8_t ctrl_buf[IS31FL3235A_NUM_CHANNELS];
-	int ret;
+	if (ease == NULL) {
+		return 0;
+	}
 
-	if (start_channel >= IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Invalid start channel %u", start_channel);
+	if (ease->type > IS31FL3235A_EASE_CUSTOM) {
+		LOG_ERR("Invalid easing curve %d", ease->type);
 		return -EINVAL;
 	}
 
-	if (start_channel + num_channels > IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Channel range %u-%u exceeds maximum %u",
-			start_channel, start_channel + num_channels - 1,
-			IS31FL3235A_NUM_CHANNELS - 1);
+	if (ease->type != IS31FL3235A_EASE_CUSTOM) {
+		return 0;
+	}
+
+	if (ease->custom == NULL) {
+		LOG_ERR("Custom easing curve missing");
 		return -EINVAL;
 	}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+	for (int i = 0; i < IS31FL3235A_EASE_POINTS; i++) {
+		if (ease->custom[i] > IS31FL3235A_EASE_ONE) {
+			LOG_ERR("Custom easing point %d above %u", i, IS31FL3235A_EASE_ONE);
+			return -EINVAL;
+		}
+	}
 
-	/* Build control register buffer, preserving current scale settings */
-	for (uint8_t i = 0; i < num_channels; i++) {
-		uint8_t ctrl_val = data->ctrl_cache[start_channel + i];
+	return 0;
+}
 
-		if (enable[i]) {
-			ctrl_val |= IS31FL3235A_CTRL_OUT_ENABLE;
-		} else {
-			ctrl_val &= ~IS31FL3235A_CTRL_OUT_ENABLE;
-		}
+/**
+ * @brief Get the table of an easing curve
+ *
+ * @param ease Valid easing, or NULL for linear
+ * @return Curve points
+ */
+static const uint16_t *is31fl3235a_ease_lut(const struct is31fl3235a_easing *ease)
+{
+	if (ease == NULL) {
+		return is31fl3235a_ease_luts[IS31FL3235A_EASE_LINEAR];
+	}
 
-		ctrl_buf[i] = ctrl_val;
+	if (ease->type == IS31FL3235A_EASE_CUSTOM) {
+		return ease->custom;
 	}
 
-	/* Write control values to consecutive registers */
-	ret = is31fl3235a_write_buffer(dev, IS31FL3235A_CTRL_REG(start_channel),
-					ctrl_buf, num_channels);
-	if (ret < 0) {
-		goto unlock;
+	return is31fl3235a_ease_luts[ease->type];
+}
+
+#endif /* IS31FL3235A_EASING */
+
+#ifdef CONFIG_LED_IS31FL3235A_EFFECTS
+/* Heartbeat level in each eighth of the period, in 1/255 of the peak */
+static const uint8_t is31fl3235a_heartbeat[8] = { 255, 0, 160, 0, 0, 0, 0, 0 };
+
+/**
+ * @brief Level of a breathe or heartbeat effect at its current time
+ *
+ * @param e Effect state
+ * @return PWM value for all of the effect's channels
+ */
+static uint8_t is31fl3235a_effect_level(const struct is31fl3235a_effect_state *e)
+{
+	uint32_t period = e->fx.period_ms;
+	uint32_t t = e->t_ms;
+
+	if (e->fx.type == IS31FL3235A_EFFECT_HEARTBEAT) {
+		return (e->fx.level * is31fl3235a_heartbeat[t * 8U / period]) / 255U;
 	}
 
-	/* Update cache */
-	memcpy(&data->ctrl_cache[start_channel], ctrl_buf, num_channels);
+	/* Fade up along the curve and back down its mirror image */
+	if (t > period / 2U) {
+		t = period - t;
+	}
 
-	LOG_DBG("Set channels %u-%u enable states (%u channels, no update)",
-		start_channel, start_channel + num_channels - 1, num_channels);
+	return (e->fx.level *
+		is31fl3235a_ease_eval(e->lut, (uint64_t)t * 2U * IS31FL3235A_EASE_T_ONE /
+					      period)) >> 15;
+}
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+/**
+ * @brief Advance a breathe or heartbeat effect by one tick
+ *
+ * Must be called with the spinlock held.
+ *
+ * @param data Driver data
+ * @param e Effect state
+ * @return Bitmap of channels changed in the shadow
+ */
+static uint32_t is31fl3235a_effect_fade(struct is31fl3235a_data *data,
+					struct is31fl3235a_effect_state *e)
+{
+	uint8_t level;
+
+	e->t_ms = (e->t_ms + CONFIG_LED_IS31FL3235A_EFFECT_TICK_MS) % e->fx.period_ms;
+	level = is31fl3235a_effect_level(e);
+	if (level == e->level) {
+		return 0;
+	}
+
+	e->level = level;
+	for (uint32_t bits = e->mask; bits != 0U; bits &= bits - 1U) {
+		data->pwm_cache[find_lsb_set(bits) - 1] = level;
+	}
+
+	return e->mask;
 }
 
 /**
- * @brief Software shutdown control (extended API)
+ * @brief Pick the channel a stepping effect lights next
+ *
+ * Chase and comet move to the next channel of the mask, wrapping around;
+ * sparkle picks one at random.
+ *
+ * @param e Effect state
+ * @param n Number of channels in the mask
+ * @return Channel number
  */
-int is31fl3235a_sw_shutdown(const struct device *dev, bool shutdown)
+static uint8_t is31fl3235a_effect_next(struct is31fl3235a_effect_state *e, uint32_t n)
 {
-	struct is31fl3235a_data *data = dev->data;
-	uint8_t value;
-	int ret;
+	uint32_t bits;
+
+	if (e->fx.type == IS31FL3235A_EFFECT_SPARKLE) {
+		uint32_t k;
+
+		/* xorshift32: cheap and good enough to scatter sparks */
+		e->rng ^= e->rng << 13;
+		e->rng ^= e->rng >> 17;
+		e->rng ^= e->rng << 5;
+		bits = e->mask;
+		for (k = e->rng % n; k > 0U; k--) {
+			bits &= bits - 1U;
+		}
+	} else {
+		bits = e->mask & ~BIT_MASK(e->head + 1U);
+		if (bits == 0U) {
+			bits = e->mask;
+		}
+	}
 
-	value = shutdown ? IS31FL3235A_SHUTDOWN_MODE : IS31FL3235A_SHUTDOWN_NORMAL;
+	return find_lsb_set(bits) - 1;
+}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+/**
+ * @brief Advance a chase, sparkle or comet effect by one tick
+ *
+ * Takes as many steps as are due, n per period for n channels. A step
+ * dims the channels still lit by one tail segment and lights the next
+ * one, so it only touches the channels that change.
+ *
+ * Must be called with the spinlock held.
+ *
+ * @param data Driver data
+ * @param e Effect state
+ * @return Bitmap of channels changed in the shadow
+ */
+static uint32_t is31fl3235a_effect_step(struct is31fl3235a_data *data,
+					struct is31fl3235a_effect_state *e)
+{
+	uint32_t n = POPCOUNT(e->mask);
+	uint32_t tail = (e->fx.type == IS31FL3235A_EFFECT_CHASE) ? 0U : e->fx.tail;
+	uint32_t decay = DIV_ROUND_UP(e->fx.level, tail + 1U);
+	uint32_t changed = 0;
+
+	e->acc += CONFIG_LED_IS31FL3235A_EFFECT_TICK_MS * n;
+	while (e->acc >= e->fx.period_ms) {
+		e->acc -= e->fx.period_ms;
+
+		for (uint32_t bits = e->lit; bits != 0U; bits &= bits - 1U) {
+			uint32_t ch = find_lsb_set(bits) - 1;
+			uint8_t v = data->pwm_cache[ch];
+
+			v = (v > decay) ? v - decay : 0U;
+			data->pwm_cache[ch] = v;
+			if (v == 0U) {
+				e->lit &= ~BIT(ch);
+			}
+			changed |= BIT(ch);
+		}
 
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_REG_SHUTDOWN, value);
-	if (ret < 0) {
-		LOG_ERR("Failed to %s software shutdown: %d",
-			shutdown ? "enter" : "exit", ret);
-		goto unlock;
+		e->head = is31fl3235a_effect_next(e, n);
+		data->pwm_cache[e->head] = e->fx.level;
+		e->lit |= BIT(e->head);
+		changed |= BIT(e->head);
 	}
 
-	data->sw_shutdown = shutdown;
+	return changed;
+}
 
-	LOG_INF("Software shutdown %s", shutdown ? "enabled" : "disabled");
+/**
+ * @brief Advance all attached effects and flush what they changed
+ */
+static void is31fl3235a_effect_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct is31fl3235a_data *data =
+		CONTAINER_OF(dwork, struct is31fl3235a_data, effect_work);
+	uint32_t changed = 0, seq = 0;
+	k_spinlock_key_t key;
+	bool running;
+
+	key = k_spin_lock(&data->lock);
+	for (int i = 0; i < CONFIG_LED_IS31FL3235A_EFFECT_SLOTS; i++) {
+		struct is31fl3235a_effect_state *e = &data->effect[i];
+
+		if (e->mask == 0U) {
+			continue;
+		}
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+		if (e->fx.type == IS31FL3235A_EFFECT_BREATHE ||
+		    e->fx.type == IS31FL3235A_EFFECT_HEARTBEAT) {
+			changed |= is31fl3235a_effect_fade(data, e);
+		} else {
+			changed |= is31fl3235a_effect_step(data, e);
+		}
+	}
+	if (changed != 0U) {
+		data->pwm_dirty |= changed;
+		data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+		seq = ++data->seq;
+	}
+	running = data->effect_channels != 0U;
+	k_spin_unlock(&data->lock, key);
+
+	/* Schedule first so the bus time does not stretch the tick */
+	if (running) {
+		k_work_schedule(dwork, K_MSEC(CONFIG_LED_IS31FL3235A_EFFECT_TICK_MS));
+	}
+
+	if (changed != 0U) {
+		(void)is31fl3235a_flush(data->dev, seq);
+	}
 }
 
 /**
- * @brief Hardware shutdown control via SDB pin (extended API)
+ * @brief Free an effect slot and stage its channels dark
+ *
+ * Must be called with the spinlock held.
+ *
+ * @param data Driver data
+ * @param e Effect state
+ * @return Sequence number of the modification
  */
-int is31fl3235a_hw_shutdown(const struct device *dev, bool shutdown)
+static uint32_t is31fl3235a_effect_release(struct is31fl3235a_data *data,
+					   struct is31fl3235a_effect_state *e)
+{
+	for (uint32_t bits = e->mask; bits != 0U; bits &= bits - 1U) {
+		data->pwm_cache[find_lsb_set(bits) - 1] = IS31FL3235A_PWM_MIN;
+	}
+	data->pwm_dirty |= e->mask;
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	data->effect_channels &= ~e->mask;
+	e->mask = 0;
+
+	return ++data->seq;
+}
+
+/**
+ * @brief Run a built-in effect on a set of channels (extended API)
+ */
+int is31fl3235a_effect_attach(const struct device *dev,
+			      uint32_t channels,
+			      const struct is31fl3235a_effect *effect)
 {
-	const struct is31fl3235a_cfg *cfg = dev->config;
 	struct is31fl3235a_data *data = dev->data;
-	int ret;
+	struct is31fl3235a_effect_state *e = NULL;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	bool start;
+	int slot, ret;
+
+	if (channels == 0U || (channels & ~IS31FL3235A_ALL_CHANNELS) != 0U) {
+		LOG_ERR("Invalid channel mask 0x%08x", channels);
+		return -EINVAL;
+	}
 
-	/* Check if SDB pin is configured */
-	if (!cfg->sdb_gpio.port) {
-		LOG_WRN("SDB pin not configured");
-		return -ENOTSUP;
+	if (effect->type > IS31FL3235A_EFFECT_COMET ||
+	    effect->period_ms < CONFIG_LED_IS31FL3235A_EFFECT_TICK_MS ||
+	    effect->period_ms > IS31FL3235A_EFFECT_PERIOD_MAX_MS) {
+		LOG_ERR("Invalid effect %d with period %u ms", effect->type,
+			effect->period_ms);
+		return -EINVAL;
+	}
+
+	ret = is31fl3235a_check_easing(&effect->ease);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = is31fl3235a_check_ready(dev);
+	if (ret < 0) {
+		return ret;
 	}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+	key = k_spin_lock(&data->lock);
+	if ((channels & data->effect_channels) != 0U) {
+		k_spin_unlock(&data->lock, key);
+		LOG_ERR("Channels 0x%08x already run an effect",
+			channels & data->effect_channels);
+		return -EBUSY;
+	}
 
-	/* Set GPIO: low=shutdown, high=normal */
-	ret = gpio_pin_set_dt(&cfg->sdb_gpio, shutdown ? 0 : 1);
+	for (slot = 0; slot < CONFIG_LED_IS31FL3235A_EFFECT_SLOTS; slot++) {
+		if (data->effect[slot].mask == 0U) {
+			e = &data->effect[slot];
+			break;
+		}
+	}
+	if (e == NULL) {
+		k_spin_unlock(&data->lock, key);
+		return -ENOSPC;
+	}
+
+	*e = (struct is31fl3235a_effect_state) {
+		.fx = *effect,
+		.mask = channels,
+		.head = find_msb_set(channels) - 1,
+		.rng = k_cycle_get_32() | 1U,
+		.lut = is31fl3235a_ease_lut(&effect->ease),
+	};
+
+	/* Start from dark: the effect lights the channels as it goes */
+	for (uint32_t bits = channels; bits != 0U; bits &= bits - 1U) {
+		data->pwm_cache[find_lsb_set(bits) - 1] = IS31FL3235A_PWM_MIN;
+	}
+	data->pwm_dirty |= channels;
+	data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+	start = data->effect_channels == 0U;
+	data->effect_channels |= channels;
+	seq = ++data->seq;
+	k_spin_unlock(&data->lock, key);
+
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_blink_cancel(dev, channels);
+#endif
+
+	if (start) {
+		k_work_schedule(&data->effect_work,
+				K_MSEC(CONFIG_LED_IS31FL3235A_EFFECT_TICK_MS));
+	}
+
+	ret = is31fl3235a_flush(dev, seq);
 	if (ret < 0) {
-		LOG_ERR("Failed to set SDB pin: %d", ret);
-		goto unlock;
+		key = k_spin_lock(&data->lock);
+		(void)is31fl3235a_effect_release(data, e);
+		k_spin_unlock(&data->lock, key);
+		return ret;
 	}
 
-	data->hw_shutdown = shutdown;
+	LOG_DBG("Effect %d attached to channels 0x%08x", effect->type, channels);
 
-	/* Brief delay for chip to respond */
-	if (!shutdown) {
-		k_msleep(IS31FL3235A_STARTUP_DELAY_MS);
+	return slot;
+}
+
+/**
+ * @brief Stop an effect and turn its channels off (extended API)
+ */
+int is31fl3235a_effect_detach(const struct device *dev, int handle)
+{
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	bool idle;
+
+	if (handle < 0 || handle >= CONFIG_LED_IS31FL3235A_EFFECT_SLOTS) {
+		LOG_ERR("Invalid effect handle %d", handle);
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&data->lock);
+	if (data->effect[handle].mask == 0U) {
+		k_spin_unlock(&data->lock, key);
+		LOG_ERR("No effect attached with handle %d", handle);
+		return -EINVAL;
 	}
+	seq = is31fl3235a_effect_release(data, &data->effect[handle]);
+	idle = data->effect_channels == 0U;
+	k_spin_unlock(&data->lock, key);
 
-	LOG_INF("Hardware shutdown %s", shutdown ? "enabled" : "disabled");
+	if (idle) {
+		k_work_cancel_delayable(&data->effect_work);
+	}
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+	return is31fl3235a_flush(dev, seq);
 }
+#endif /* CONFIG_LED_IS31FL3235A_EFFECTS */
 
+#ifdef CONFIG_LED_IS31FL3235A_FADE
 /**
- * @brief Global LED enable/disable via Global Control Register (extended API)
+ * @brief Advance a fade to the current time
  *
- * This uses the Global Control Register (0x4A) to enable or disable all
- * LED outputs simultaneously without affecting individual channel settings.
- * Unlike software shutdown, the chip remains fully operational.
+ * The curve is evaluated once per fade; the lerp kernel then blends the
+ * start and target frames word by word, and the frame diff picks out the
+ * channels that changed. Must be called with the spinlock held.
  *
- * @param dev Pointer to device structure
- * @param enable true for normal operation, false to shutdown all LEDs
- * @return 0 on success, negative errno on error
+ * @param data Driver data
+ * @param f Fade state
+ * @param now Uptime in milliseconds
+ * @return Bitmap of channels changed in the shadow
  */
-int is31fl3235a_global_enable(const struct device *dev, bool enable)
+static uint32_t is31fl3235a_fade_advance(struct is31fl3235a_data *data,
+					 struct is31fl3235a_fade_state *f,
+					 uint32_t now)
 {
-	struct is31fl3235a_data *data = dev->data;
-	uint8_t value;
-	int ret;
-
-	/* G_EN bit: 0 = normal operation, 1 = shutdown all LEDs */
-	value = enable ? IS31FL3235A_GLOBAL_CTRL_NORMAL : IS31FL3235A_GLOBAL_CTRL_SHUTDOWN;
+	uint32_t elapsed = now - f->start_ms;
+	union is31fl3235a_frame cur, v;
+	uint32_t changed;
+	uint32_t y;
+
+	if (elapsed >= f->duration_ms) {
+		/* Land exactly on the targets, whatever the curve ends at */
+		y = IS31FL3235A_EASE_ONE;
+	} else {
+		y = is31fl3235a_ease_eval(f->lut, (uint64_t)elapsed *
+					  IS31FL3235A_EASE_T_ONE / f->duration_ms);
+	}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+	/* Q15 curve value to the Q8 blend position of the lerp kernel */
+	is31fl3235a_frame_lerp(&v, &f->from, &f->to, (y + 64U) >> 7);
+	memcpy(cur.b, data->pwm_cache, sizeof(cur.b));
+	changed = is31fl3235a_frame_diff(&v, &cur) & f->mask;
+	for (uint32_t bits = changed; bits != 0U; bits &= bits - 1U) {
+		uint32_t ch = find_lsb_set(bits) - 1;
 
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_REG_GLOBAL_CTRL, value);
-	if (ret < 0) {
-		LOG_ERR("Failed to set global enable: %d", ret);
-		goto unlock;
+		data->pwm_cache[ch] = v.b[ch];
 	}
 
-	LOG_INF("Global LED output %s", enable ? "enabled" : "disabled");
+	if (elapsed >= f->duration_ms) {
+		data->fade_channels &= ~f->mask;
+		f->mask = 0;
+	}
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+	return changed;
 }
 
 /**
- * @brief Manually trigger update (extended API)
+ * @brief Advance all running fades and flush what they changed
  */
-int is31fl3235a_update(const struct device *dev)
+static void is31fl3235a_fade_work_handler(struct k_work *work)
 {
-	struct is31fl3235a_data *data = dev->data;
-	int ret;
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct is31fl3235a_data *data =
+		CONTAINER_OF(dwork, struct is31fl3235a_data, fade_work);
+	uint32_t now = k_uptime_get_32();
+	uint32_t changed = 0, seq = 0;
+	k_spinlock_key_t key;
+	bool running;
+
+	key = k_spin_lock(&data->lock);
+	for (int i = 0; i < CONFIG_LED_IS31FL3235A_FADE_SLOTS; i++) {
+		if (data->fade[i].mask != 0U) {
+			changed |= is31fl3235a_fade_advance(data, &data->fade[i], now);
+		}
+	}
+	if (changed != 0U) {
+		data->pwm_dirty |= changed;
+		data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+		seq = ++data->seq;
+	}
+	running = data->fade_channels != 0U;
+	k_spin_unlock(&data->lock, key);
 
-	k_mutex_lock(&data->lock, K_FOREVER);
-	ret = is31fl3235a_trigger_update(dev);
-	k_mutex_unlock(&data->lock);
+	if (running) {
+		k_work_schedule(dwork, K_MSEC(CONFIG_LED_IS31FL3235A_FADE_TICK_MS));
+	}
 
-	return ret;
+	if (changed != 0U) {
+		(void)is31fl3235a_flush(data->dev, seq);
+	}
 }
 
 /**
- * @brief Set brightness for a single LED channel without triggering update (extended API)
- *
- * @param dev Pointer to device structure
- * @param led Channel number (0-27)
- * @param value Brightness value (0-255)
- * @return 0 on success, negative errno on error
+ * @brief Fade channels to new PWM values (extended API)
  */
-int is31fl3235a_set_brightness_no_update(const struct device *dev,
-					  uint32_t led,
-					  uint8_t value)
+int is31fl3235a_fade(const struct device *dev,
+		     uint32_t start_channel,
+		     uint32_t num_channels,
+		     const uint8_t *target,
+		     uint32_t duration_ms,
+		     const struct is31fl3235a_easing *ease)
 {
 	struct is31fl3235a_data *data = dev->data;
+	struct is31fl3235a_fade_state *f = NULL;
+	k_spinlock_key_t key;
+	uint32_t mask, seq;
+	bool start;
 	int ret;
 
-	if (led >= IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Invalid channel %u (max %u)", led,
-			IS31FL3235A_NUM_CHANNELS - 1);
-		return -EINVAL;
+	ret = is31fl3235a_check_range(start_channel, num_channels);
+	if (ret < 0) {
+		return ret;
 	}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+	ret = is31fl3235a_check_easing(ease);
+	if (ret < 0) {
+		return ret;
+	}
 
-	/* Write PWM value to register */
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_PWM_REG(led), value);
+	ret = is31fl3235a_check_ready(dev);
 	if (ret < 0) {
-		goto unlock;
+		return ret;
 	}
 
-	/* Update cache */
-	data->pwm_cache[led] = value;
+	mask = is31fl3235a_range_mask(start_channel, num_channels);
 
-	LOG_DBG("Set channel %u brightness to %u (no update)", led, value);
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	is31fl3235a_blink_cancel(dev, mask);
+#endif
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+	key = k_spin_lock(&data->lock);
+	if (duration_ms != 0U) {
+		/* A slot whose channels are all taken over is free as well */
+		for (int i = 0; i < CONFIG_LED_IS31FL3235A_FADE_SLOTS; i++) {
+			if ((data->fade[i].mask & ~mask) == 0U) {
+				f = &data->fade[i];
+				break;
+			}
+		}
+		if (f == NULL) {
+			k_spin_unlock(&data->lock, key);
+			return -ENOSPC;
+		}
+	}
+
+	for (int i = 0; i < CONFIG_LED_IS31FL3235A_FADE_SLOTS; i++) {
+		data->fade[i].mask &= ~mask;
+	}
+	data->fade_channels &= ~mask;
+
+	if (f == NULL) {
+		memcpy(&data->pwm_cache[start_channel], target, num_channels);
+		data->pwm_dirty |= mask;
+		data->sync_flags |= IS31FL3235A_SYNC_UPDATE;
+		seq = ++data->seq;
+		k_spin_unlock(&data->lock, key);
+
+		return is31fl3235a_flush(dev, seq);
+	}
+
+	f->mask = mask;
+	f->start_ms = k_uptime_get_32();
+	f->duration_ms = duration_ms;
+	f->lut = is31fl3235a_ease_lut(ease);
+	memcpy(&f->from.b[start_channel], &data->pwm_cache[start_channel], num_channels);
+	memcpy(&f->to.b[start_channel], target, num_channels);
+	start = data->fade_channels == 0U;
+	data->fade_channels |= mask;
+	k_spin_unlock(&data->lock, key);
+
+	if (start) {
+		k_work_schedule(&data->fade_work, K_MSEC(CONFIG_LED_IS31FL3235A_FADE_TICK_MS));
+	}
+
+	LOG_DBG("Fading channels %u-%u over %u ms", start_channel,
+		start_channel + num_channels - 1, duration_ms);
+
+	return 0;
 }
+#endif /* CONFIG_LED_IS31FL3235A_FADE */
 
 /**
- * @brief Write brightness values to multiple consecutive channels without triggering update (extended API)
+ * @brief Load the power-on state into the shadow and mark it dirty
+ *
+ * All channels enabled, 1x current, 0 brightness, outputs on and out of
+ * software shutdown, with the device tree boot frame applied on top. The
+ * boot frame is thereby carried by the same bursts that initialize the
+ * chip rather than by separate writes after it.
  *
  * @param dev Pointer to device structure
- * @param start_channel First channel number
- * @param num_channels Number of consecutive channels
- * @param buf Buffer containing brightness values
- * @return 0 on success, negative errno on error
  */
-int is31fl3235a_write_channels_no_update(const struct device *dev,
-					  uint32_t start_channel,
-					  uint32_t num_channels,
-					  const uint8_t *buf)
+static void is31fl3235a_init_shadow(const struct device *dev)
 {
+	const struct is31fl3235a_cfg *cfg = dev->config;
 	struct is31fl3235a_data *data = dev->data;
-	int ret;
 
-	if (start_channel >= IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Invalid start channel %u", start_channel);
-		return -EINVAL;
+	memset(data->pwm_cache, 0, sizeof(data->pwm_cache));
+	memset(data->ctrl_cache, IS31FL3235A_CTRL_ENABLE_1X, sizeof(data->ctrl_cache));
+#ifdef CONFIG_LED_IS31FL3235A_DIMMER
+	data->master = UINT8_MAX;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		data->imax_ua[i] = cfg->imax_ua;
 	}
-
-	if (start_channel + num_channels > IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Channel range %u-%u exceeds maximum %u",
-			start_channel, start_channel + num_channels - 1,
-			IS31FL3235A_NUM_CHANNELS - 1);
-		return -EINVAL;
+	data->budget_ua = cfg->budget_ua;
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		data->gain[i] = IS31FL3235A_GAIN_UNITY;
+	}
+#endif
+	for (uint8_t i = 0; i < cfg->boot_frame_len; i++) {
+		const struct is31fl3235a_boot_channel *entry = &cfg->boot_frame[i];
+
+		memset(&data->pwm_cache[entry->channel], entry->pwm,
+		       entry->num_channels);
+		memset(&data->ctrl_cache[entry->channel], entry->ctrl,
+		       entry->num_channels);
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+		if (entry->gain != NULL) {
+			memcpy(&data->gain[entry->channel], entry->gain,
+			       entry->num_channels * sizeof(entry->gain[0]));
+		}
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_CURRENT_LIMIT
+		if (entry->imax_ua != 0U) {
+			for (uint8_t c = 0; c < entry->num_channels; c++) {
+				data->imax_ua[entry->channel + c] = entry->imax_ua;
+			}
+		}
+#endif
 	}
+#ifdef CONFIG_LED_IS31FL3235A_CALIBRATION
+	is31fl3235a_update_gain(data);
+#endif
+	data->sw_shutdown = false;
+	data->global_enable = true;
+	data->pwm_dirty = IS31FL3235A_ALL_CHANNELS;
+	data->ctrl_dirty = IS31FL3235A_ALL_CHANNELS;
+	data->sync_flags = IS31FL3235A_SYNC_ALL;
+	data->seq = 1;
+}
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+/**
+ * @brief Reset the chip to its power-on register state
+ *
+ * @param dev Pointer to device structure
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_reset_chip(const struct device *dev)
+{
+	int ret;
 
-	/* Write PWM values to consecutive registers */
-	ret = is31fl3235a_write_buffer(dev, IS31FL3235A_PWM_REG(start_channel),
-					buf, num_channels);
+	ret = is31fl3235a_write_reg(dev, IS31FL3235A_REG_RESET,
+				     IS31FL3235A_RESET_TRIGGER);
 	if (ret < 0) {
-		goto unlock;
+		LOG_ERR("Failed to reset chip: %d", ret);
+		return ret;
 	}
 
-	/* Update cache */
-	memcpy(&data->pwm_cache[start_channel], buf, num_channels);
-
-	LOG_DBG("Set channels %u-%u (%u channels, no update)",
-		start_channel, start_channel + num_channels - 1, num_channels);
-
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+	return 0;
 }
 
 /**
- * @brief Set brightness for a single LED channel using raw 0-255 value (extended API)
+ * @brief Open the bus to flushes and write the shadow to a reset chip
  *
- * This function provides direct hardware control with 0-255 PWM values,
- * equivalent to the standard led_set_brightness() but with full 8-bit resolution.
+ * Everything staged so far, including writes made before the device was
+ * ready, goes out in a single flush of a handful of bursts and one update.
  *
  * @param dev Pointer to device structure
- * @param led Channel number (0-27)
- * @param value Brightness value (0-255)
  * @return 0 on success, negative errno on error
  */
-int is31fl3235a_set_brightness(const struct device *dev,
-				uint32_t led,
-				uint8_t value)
+static int is31fl3235a_program(const struct device *dev)
 {
+	const struct is31fl3235a_cfg *cfg = dev->config;
 	struct is31fl3235a_data *data = dev->data;
 	int ret;
 
-	if (led >= IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Invalid channel %u (max %u)", led,
-			IS31FL3235A_NUM_CHANNELS - 1);
-		return -EINVAL;
-	}
-
-	k_mutex_lock(&data->lock, K_FOREVER);
+	k_mutex_lock(&data->bus_lock, K_FOREVER);
+	data->initialized = true;
+	k_mutex_unlock(&data->bus_lock);
 
-	/* Write PWM value to register */
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_PWM_REG(led), value);
+	ret = is31fl3235a_restore(dev);
 	if (ret < 0) {
-		goto unlock;
+		LOG_ERR("Failed to program initial state: %d", ret);
+		data->initialized = false;
+		return ret;
 	}
 
-	/* Update cache */
-	data->pwm_cache[led] = value;
+	LOG_INF("IS31FL3235A initialized successfully (PWM: %s, I2C: 0x%02x)",
+		cfg->pwm_freq_22khz ? "22kHz" : "3kHz", cfg->i2c.addr);
 
-	/* Trigger update to apply change */
-	ret = is31fl3235a_trigger_update(dev);
-	if (ret < 0) {
-		goto unlock;
-	}
+	return 0;
+}
 
-	LOG_DBG("Set channel %u brightness to %u (raw)", led, value);
+#ifdef CONFIG_LED_IS31FL3235A_ASYNC_INIT
+static void is31fl3235a_boot_work_handler(struct k_work *work);
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
-}
+static K_WORK_DELAYABLE_DEFINE(is31fl3235a_boot_work, is31fl3235a_boot_work_handler);
 
 /**
- * @brief Write brightness values to multiple channels using raw 0-255 values (extended API)
+ * @brief Count a failed bring-up step and decide whether to retry it
  *
- * This function provides direct hardware control with 0-255 PWM values,
- * equivalent to the standard led_write_channels() but with full 8-bit resolution.
+ * The step stays pending and is retried after a delay that doubles with
+ * every failure. Once IS31FL3235A_BOOT_RETRIES have failed, the device
+ * is marked failed so API calls report it instead of staging writes
+ * that never reach the chip.
  *
  * @param dev Pointer to device structure
- * @param start_channel First channel number (0-27)
- * @param num_channels Number of consecutive channels to write
- * @param buf Array of brightness values (0-255)
- * @return 0 on success, negative errno on error
+ * @param err Error of the failed step
+ * @return Delay before the retry in milliseconds, 0 if giving up
  */
-int is31fl3235a_write_channels(const struct device *dev,
-				uint32_t start_channel,
-				uint32_t num_channels,
-				const uint8_t *buf)
+static uint32_t is31fl3235a_boot_retry(const struct device *dev, int err)
 {
 	struct is31fl3235a_data *data = dev->data;
-	int ret;
 
-	if (start_channel >= IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Invalid start channel %u", start_channel);
-		return -EINVAL;
+	if (data->boot_tries >= IS31FL3235A_BOOT_RETRIES) {
+		LOG_ERR("Bring-up failed after %u retries: %d", data->boot_tries, err);
+		data->boot_stage = IS31FL3235A_BOOT_FAILED;
+		return 0;
 	}
 
-	if (start_channel + num_channels > IS31FL3235A_NUM_CHANNELS) {
-		LOG_ERR("Channel range %u-%u exceeds maximum %u",
-			start_channel, start_channel + num_channels - 1,
-			IS31FL3235A_NUM_CHANNELS - 1);
-		return -EINVAL;
-	}
+	LOG_WRN("Bring-up step failed (%d), retrying", err);
 
-	k_mutex_lock(&data->lock, K_FOREVER);
+	return IS31FL3235A_BOOT_RETRY_DELAY_MS << data->boot_tries++;
+}
 
-	/* Write PWM values to consecutive registers */
-	ret = is31fl3235a_write_buffer(dev, IS31FL3235A_PWM_REG(start_channel),
-					buf, num_channels);
-	if (ret < 0) {
-		goto unlock;
-	}
+/**
+ * @brief Bring up all pending instances together
+ *
+ * Runs once the startup delay after SDB went high has elapsed for every
+ * instance: resets all pending chips back to back, then reschedules
+ * itself so a single reset delay covers all of them before they are
+ * programmed. Failed steps are retried on a later pass.
+ */
+static void is31fl3235a_boot_work_handler(struct k_work *work)
+{
+	uint32_t delay_ms = 0;
+	int ret;
 
-	/* Update cache */
-	memcpy(&data->pwm_cache[start_channel], buf, num_channels);
+	ARG_UNUSED(work);
 
-	/* Trigger update to apply all changes simultaneously */
-	ret = is31fl3235a_trigger_update(dev);
-	if (ret < 0) {
-		goto unlock;
+	/* Chips reset on an earlier pass have waited out the reset delay */
+	for (size_t i = 0; i < ARRAY_SIZE(is31fl3235a_devices); i++) {
+		const struct device *dev = is31fl3235a_devices[i];
+		struct is31fl3235a_data *data = dev->data;
+
+		if (data->boot_stage != IS31FL3235A_BOOT_PROGRAM) {
+			continue;
+		}
+
+		ret = is31fl3235a_program(dev);
+		if (ret < 0) {
+			delay_ms = MAX(delay_ms, is31fl3235a_boot_retry(dev, ret));
+			continue;
+		}
+
+		data->boot_stage = IS31FL3235A_BOOT_IDLE;
 	}
 
-	LOG_DBG("Set channels %u-%u (%u channels, raw)",
-		start_channel, start_channel + num_channels - 1, num_channels);
+	for (size_t i = 0; i < ARRAY_SIZE(is31fl3235a_devices); i++) {
+		const struct device *dev = is31fl3235a_devices[i];
+		struct is31fl3235a_data *data = dev->data;
 
-unlock:
-	k_mutex_unlock(&data->lock);
-	return ret;
+		if (data->boot_stage != IS31FL3235A_BOOT_RESET) {
+			continue;
+		}
+
+		ret = is31fl3235a_reset_chip(dev);
+		if (ret < 0) {
+			delay_ms = MAX(delay_ms, is31fl3235a_boot_retry(dev, ret));
+			continue;
+		}
+
+		data->boot_stage = IS31FL3235A_BOOT_PROGRAM;
+		delay_ms = MAX(delay_ms, IS31FL3235A_RESET_DELAY_MS);
+	}
+
+	if (delay_ms > 0U) {
+		k_work_schedule(&is31fl3235a_boot_work, K_MSEC(delay_ms));
+	}
 }
+#endif /* CONFIG_LED_IS31FL3235A_ASYNC_INIT */
 
 /**
  * @brief Initialize the IS31FL3235A device
@@ -821,13 +4475,66 @@ static int is31fl3235a_init(const struct device *dev)
 {
 	const struct is31fl3235a_cfg *cfg = dev->config;
 	struct is31fl3235a_data *data = dev->data;
-	uint8_t freq_val;
+	bool warm = false;
 	int ret;
 
 	LOG_INF("Initializing IS31FL3235A");
 
-	/* Initialize mutex */
-	k_mutex_init(&data->lock);
+	/* Initialize bus mutex */
+	k_mutex_init(&data->bus_lock);
+#ifdef CONFIG_LED_IS31FL3235A_FRAMEBUFFER
+	k_mutex_init(&data->frame_lock);
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_CLOCK
+	k_timer_init(&data->clock_timer, is31fl3235a_clock_expiry, NULL);
+	k_work_init(&data->clock_work, is31fl3235a_clock_work_handler);
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT
+	k_work_init_delayable(&data->latch_work, is31fl3235a_latch_work_handler);
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_PARTITIONS
+	for (int i = 0; i < CONFIG_LED_IS31FL3235A_PARTITION_COUNT; i++) {
+		data->part[i].dev = dev;
+		data->part[i].mask = cfg->part_masks[i];
+	}
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_BLINK
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		sys_dnode_init(&data->blink[i].node);
+		data->blink[i].dev = dev;
+		data->blink[i].channel = i;
+	}
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_FRAME_QUEUE
+	k_msgq_init(&data->queue, cfg->queue_buf, sizeof(struct is31fl3235a_frame_entry),
+		    CONFIG_LED_IS31FL3235A_FRAME_QUEUE_DEPTH);
+#endif
+
+	data->dev = dev;
+#ifdef CONFIG_LED_IS31FL3235A_AUTO_IDLE
+	k_work_init_delayable(&data->idle_work, is31fl3235a_idle_work_handler);
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_EFFECTS
+	k_work_init_delayable(&data->effect_work, is31fl3235a_effect_work_handler);
+#endif
+#ifdef CONFIG_LED_IS31FL3235A_FADE
+	k_work_init_delayable(&data->fade_work, is31fl3235a_fade_work_handler);
+#endif
+
+#ifdef CONFIG_LED_IS31FL3235A_REMAP
+	if (cfg->channel_map != NULL) {
+		uint32_t outputs = 0;
+
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			outputs |= BIT(cfg->channel_map[i]);
+		}
+		if (outputs != IS31FL3235A_ALL_CHANNELS) {
+			LOG_ERR("channel-map is not a permutation of 0-%u",
+				IS31FL3235A_NUM_CHANNELS - 1);
+			return -EINVAL;
+		}
+	}
+#endif
 
 	/* Check I2C bus ready */
 	if (!device_is_ready(cfg->i2c.bus)) {
@@ -857,95 +4564,287 @@ static int is31fl3235a_init(const struct device *dev)
 
 		data->hw_shutdown = false;
 
-		/* Wait for chip to start up */
-		k_msleep(IS31FL3235A_STARTUP_DELAY_MS);
-
 		LOG_DBG("SDB pin configured and set high");
 	}
 
-	/* Reset chip to known state */
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_REG_RESET,
-				     IS31FL3235A_RESET_TRIGGER);
-	if (ret < 0) {
-		LOG_ERR("Failed to reset chip: %d", ret);
-		return ret;
+	/* API calls made before the chip is programmed land in the shadow */
+	is31fl3235a_init_shadow(dev);
+
+#ifdef CONFIG_LED_IS31FL3235A_RETAINED_STATE
+	/*
+	 * After a warm reboot the chip still shows the retained frame:
+	 * skip the reset so the LEDs do not blank, and only reassert it.
+	 */
+	warm = is31fl3235a_load_retained(dev);
+	if (warm) {
+		LOG_DBG("Retained state valid, skipping chip reset");
 	}
+#endif
 
-	/* Wait for reset to complete */
-	k_msleep(IS31FL3235A_RESET_DELAY_MS);
+#ifdef CONFIG_LED_IS31FL3235A_FRAMEBUFFER
+	/* Composition starts from the frame shown after bring-up */
+	memcpy(data->back.b, data->pwm_cache, sizeof(data->back.b));
+#endif
 
-	LOG_DBG("Chip reset complete");
+#ifdef CONFIG_LED_IS31FL3235A_ASYNC_INIT
+	/*
+	 * Defer the delays and register writes to a work item shared by
+	 * all instances. Rescheduling pushes it out so the startup delay
+	 * covers the chip whose SDB pin was raised last.
+	 */
+	data->boot_stage = warm ? IS31FL3235A_BOOT_PROGRAM : IS31FL3235A_BOOT_RESET;
+	k_work_reschedule(&is31fl3235a_boot_work, K_MSEC(IS31FL3235A_STARTUP_DELAY_MS));
 
-	/* Wake from software shutdown */
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_REG_SHUTDOWN,
-				     IS31FL3235A_SHUTDOWN_NORMAL);
-	if (ret < 0) {
-		LOG_ERR("Failed to wake from shutdown: %d", ret);
-		return ret;
+	LOG_DBG("Chip bring-up deferred");
+
+	return 0;
+#else
+	if (cfg->sdb_gpio.port) {
+		/* Wait for chip to start up */
+		k_msleep(IS31FL3235A_STARTUP_DELAY_MS);
 	}
 
-	data->sw_shutdown = false;
+	if (!warm) {
+		/* Reset chip to known state */
+		ret = is31fl3235a_reset_chip(dev);
+		if (ret < 0) {
+			return ret;
+		}
 
-	/* Configure PWM frequency */
-	freq_val = cfg->pwm_freq_22khz ? IS31FL3235A_FREQ_22KHZ :
-					  IS31FL3235A_FREQ_3KHZ;
-	ret = is31fl3235a_write_reg(dev, IS31FL3235A_REG_FREQ, freq_val);
-	if (ret < 0) {
-		LOG_ERR("Failed to set PWM frequency: %d", ret);
-		return ret;
+		/* Wait for reset to complete */
+		k_msleep(IS31FL3235A_RESET_DELAY_MS);
+
+		LOG_DBG("Chip reset complete");
 	}
 
-	LOG_DBG("PWM frequency set to %s", cfg->pwm_freq_22khz ? "22kHz" : "3kHz");
+	return is31fl3235a_program(dev);
+#endif
+}
 
-	/* Initialize all channels: enabled, 1x current, 0 brightness */
-	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
-		/* Set PWM to 0 */
-		ret = is31fl3235a_write_reg(dev, IS31FL3235A_PWM_REG(i), 0);
+#ifdef CONFIG_PM_DEVICE
+/**
+ * @brief Power management action handler
+ *
+ * Suspend enters software shutdown and, when an SDB pin is configured,
+ * hardware shutdown. Writes made while suspended only update the shadow.
+ * Resume and turn-on replay the whole shadow, so the chip comes back
+ * with the state it had, including changes made while it was down.
+ *
+ * @param dev Pointer to device structure
+ * @param action Requested power management action
+ * @return 0 on success, negative errno on error
+ */
+static int is31fl3235a_pm_action(const struct device *dev,
+				 enum pm_device_action action)
+{
+	const struct is31fl3235a_cfg *cfg = dev->config;
+	struct is31fl3235a_data *data = dev->data;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	int ret = 0;
+
+	switch (action) {
+	case PM_DEVICE_ACTION_SUSPEND:
+		key = k_spin_lock(&data->lock);
+		data->pm_suspended = true;
+		k_spin_unlock(&data->lock, key);
+
+		seq = is31fl3235a_stage_sync(dev, IS31FL3235A_SYNC_SHUTDOWN);
+		ret = is31fl3235a_flush(dev, seq);
 		if (ret < 0) {
-			LOG_ERR("Failed to init PWM register %d: %d", i, ret);
 			return ret;
 		}
-		data->pwm_cache[i] = 0;
+		__fallthrough;
 
-		/* Set control: enabled, 1x current */
-		uint8_t ctrl = IS31FL3235A_CTRL_ENABLE_1X;
-		ret = is31fl3235a_write_reg(dev, IS31FL3235A_CTRL_REG(i), ctrl);
+	case PM_DEVICE_ACTION_TURN_OFF:
+		k_mutex_lock(&data->bus_lock, K_FOREVER);
+		if (cfg->sdb_gpio.port && action == PM_DEVICE_ACTION_SUSPEND) {
+			ret = gpio_pin_set_dt(&cfg->sdb_gpio, 0);
+		}
+		if (ret == 0) {
+			data->bus_suspended = true;
+		}
+		k_mutex_unlock(&data->bus_lock);
+		break;
+
+	case PM_DEVICE_ACTION_RESUME:
+	case PM_DEVICE_ACTION_TURN_ON:
+		k_mutex_lock(&data->bus_lock, K_FOREVER);
+		if (cfg->sdb_gpio.port && !data->hw_shutdown) {
+			ret = gpio_pin_set_dt(&cfg->sdb_gpio, 1);
+			if (ret == 0) {
+				k_msleep(IS31FL3235A_STARTUP_DELAY_MS);
+			}
+		}
+		data->bus_suspended = false;
+		k_mutex_unlock(&data->bus_lock);
 		if (ret < 0) {
-			LOG_ERR("Failed to init control register %d: %d", i, ret);
 			return ret;
 		}
-		data->ctrl_cache[i] = ctrl;
-	}
 
-	/* Trigger update to apply all initialization settings */
-	ret = is31fl3235a_trigger_update(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to trigger initial update: %d", ret);
-		return ret;
-	}
+		key = k_spin_lock(&data->lock);
+		data->pm_suspended = false;
+		k_spin_unlock(&data->lock, key);
 
-	/* Mark as initialized */
-	data->initialized = true;
+		/* Registers may have been lost while powered down */
+		ret = is31fl3235a_restore(dev);
+		break;
 
-	LOG_INF("IS31FL3235A initialized successfully (PWM: %s, I2C: 0x%02x)",
-		cfg->pwm_freq_22khz ? "22kHz" : "3kHz", cfg->i2c.addr);
+	default:
+		return -ENOTSUP;
+	}
 
-	return 0;
+	return ret;
 }
+#endif /* CONFIG_PM_DEVICE */
+
+/* Number of consecutive channels driven by one child node */
+#define IS31FL3235A_LED_NUM_COLORS(node)					\
+	DT_PROP_LEN_OR(node, color_mapping, 1)
+
+/* Reject child nodes that do not fit in the channel range */
+#define IS31FL3235A_CHECK_CHANNEL(node)						\
+	BUILD_ASSERT(DT_REG_ADDR(node) + IS31FL3235A_LED_NUM_COLORS(node) <=	\
+		     IS31FL3235A_NUM_CHANNELS,					\
+		     "IS31FL3235A child reg out of range");			\
+	BUILD_ASSERT(DT_PROP_LEN_OR(node, color_gain,				\
+				    IS31FL3235A_LED_NUM_COLORS(node)) ==	\
+		     IS31FL3235A_LED_NUM_COLORS(node),				\
+		     "IS31FL3235A color-gain needs one entry per color");
+
+/* Calibration gains of one child node, if it has color-gain */
+#define IS31FL3235A_LED_GAINS(node)						\
+	IF_ENABLED(DT_NODE_HAS_PROP(node, color_gain),				\
+		   (static const uint16_t is31fl3235a_gain_##node[] =		\
+			   DT_PROP(node, color_gain);))
+
+/* Boot frame entry for one child node */
+#define IS31FL3235A_BOOT_CHANNEL(node)						\
+	{									\
+		.channel = DT_REG_ADDR(node),					\
+		.num_channels = IS31FL3235A_LED_NUM_COLORS(node),		\
+		.pwm = DT_PROP(node, default_brightness),			\
+		.ctrl = (DT_PROP(node, default_disabled) ?			\
+			 IS31FL3235A_CTRL_OUT_DISABLE :				\
+			 IS31FL3235A_CTRL_OUT_ENABLE) |				\
+			((DT_PROP(node, current_scale) - 1) <<			\
+			 IS31FL3235A_CTRL_SL_SHIFT),				\
+		IF_ENABLED(CONFIG_LED_IS31FL3235A_CALIBRATION,			\
+			   (.gain = COND_CODE_1(DT_NODE_HAS_PROP(node, color_gain),\
+						(is31fl3235a_gain_##node),	\
+						(NULL)),))			\
+		IF_ENABLED(CONFIG_LED_IS31FL3235A_CURRENT_LIMIT,		\
+			   (.imax_ua = DT_PROP_OR(node, imax_microamp, 0),))	\
+	},
+
+/* Color mapping of one child node: color-mapping, else its single color */
+#define IS31FL3235A_LED_COLORS(node)						\
+	static const uint8_t is31fl3235a_colors_##node[] =			\
+		COND_CODE_1(DT_NODE_HAS_PROP(node, color_mapping),		\
+			    (DT_PROP(node, color_mapping)),			\
+			    ({DT_PROP_OR(node, color, LED_COLOR_ID_WHITE)}));
+
+/* led_info entry for one child node */
+#define IS31FL3235A_LED_INFO(node)						\
+	{									\
+		.label = DT_PROP_OR(node, label, NULL),				\
+		.index = DT_REG_ADDR(node),					\
+		.num_colors = ARRAY_SIZE(is31fl3235a_colors_##node),		\
+		.color_mapping = is31fl3235a_colors_##node,			\
+	},
+
+/* Channel routing table of an instance, if it has channel-map */
+#define IS31FL3235A_CHANNEL_MAP(inst)						\
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(inst, channel_map),			\
+		   (BUILD_ASSERT(DT_INST_PROP_LEN(inst, channel_map) ==		\
+				 IS31FL3235A_NUM_CHANNELS,			\
+				 "IS31FL3235A channel-map needs 28 entries");	\
+		    static const uint8_t is31fl3235a_channel_map_##inst[] =	\
+			    DT_INST_PROP(inst, channel_map);))
+
+/* Channels of one child node, if it belongs to partition p */
+#define IS31FL3235A_PART_CHILD_MASK(node, p)					\
+	| ((DT_PROP_OR(node, partition, -1) == (p)) ?				\
+	   (BIT_MASK(IS31FL3235A_LED_NUM_COLORS(node)) << DT_REG_ADDR(node)) : 0U)
+
+/* Channels of partition p of an instance */
+#define IS31FL3235A_PART_MASK(p, inst)						\
+	(0U DT_INST_FOREACH_CHILD_VARGS(inst, IS31FL3235A_PART_CHILD_MASK, p))
+
+/* Reject partition numbers beyond the configured count */
+#define IS31FL3235A_CHECK_PARTITION(node)					\
+	BUILD_ASSERT(DT_PROP_OR(node, partition, 0) <				\
+		     CONFIG_LED_IS31FL3235A_PARTITION_COUNT,			\
+		     "IS31FL3235A partition out of range");
 
 /* Device instantiation macro */
 #define IS31FL3235A_DEFINE(inst)						\
 	static struct is31fl3235a_data is31fl3235a_data_##inst;			\
+	DT_INST_FOREACH_CHILD(inst, IS31FL3235A_CHECK_CHANNEL)			\
+	DT_INST_FOREACH_CHILD(inst, IS31FL3235A_LED_COLORS)			\
+	static const struct led_info is31fl3235a_leds_##inst[] = {		\
+		DT_INST_FOREACH_CHILD(inst, IS31FL3235A_LED_INFO)		\
+	};									\
+	IF_ENABLED(CONFIG_LED_IS31FL3235A_CALIBRATION,				\
+		   (DT_INST_FOREACH_CHILD(inst, IS31FL3235A_LED_GAINS)))	\
+	BUILD_ASSERT(ARRAY_SIZE(is31fl3235a_leds_##inst) <=			\
+		     IS31FL3235A_NUM_CHANNELS,					\
+		     "IS31FL3235A has more child nodes than channels");	\
+	IF_ENABLED(CONFIG_LED_IS31FL3235A_COLOR_MATRIX,				\
+		   (static struct is31fl3235a_color_matrix			\
+			   is31fl3235a_matrices_##inst[				\
+				   ARRAY_SIZE(is31fl3235a_leds_##inst)];))	\
+	IF_ENABLED(CONFIG_LED_IS31FL3235A_REMAP,				\
+		   (IS31FL3235A_CHANNEL_MAP(inst)))				\
+	static const struct is31fl3235a_boot_channel				\
+		is31fl3235a_boot_frame_##inst[] = {				\
+		DT_INST_FOREACH_CHILD(inst, IS31FL3235A_BOOT_CHANNEL)		\
+	};									\
+	IF_ENABLED(CONFIG_LED_IS31FL3235A_RETAINED_STATE,			\
+		   (static __noinit struct is31fl3235a_retained		\
+			   is31fl3235a_retained_##inst;))			\
+	IF_ENABLED(CONFIG_LED_IS31FL3235A_PARTITIONS,				\
+		   (DT_INST_FOREACH_CHILD(inst, IS31FL3235A_CHECK_PARTITION)	\
+		    static const uint32_t is31fl3235a_part_masks_##inst[] = {	\
+			    LISTIFY(CONFIG_LED_IS31FL3235A_PARTITION_COUNT,	\
+				    IS31FL3235A_PART_MASK, (,), inst)		\
+		    };))							\
+	IF_ENABLED(CONFIG_LED_IS31FL3235A_FRAME_QUEUE,				\
+		   (static char __aligned(8) is31fl3235a_queue_buf_##inst[	\
+			   CONFIG_LED_IS31FL3235A_FRAME_QUEUE_DEPTH *		\
+			   sizeof(struct is31fl3235a_frame_entry)];))		\
 										\
 	static const struct is31fl3235a_cfg is31fl3235a_cfg_##inst = {		\
 		.i2c = I2C_DT_SPEC_INST_GET(inst),				\
 		.sdb_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, sdb_gpios, {0}),	\
 		.pwm_freq_22khz = (DT_INST_PROP(inst, pwm_frequency) == 22000),\
+		.boot_frame = is31fl3235a_boot_frame_##inst,			\
+		.boot_frame_len = ARRAY_SIZE(is31fl3235a_boot_frame_##inst),	\
+		.leds = is31fl3235a_leds_##inst,				\
+		.num_leds = ARRAY_SIZE(is31fl3235a_leds_##inst),		\
+		IF_ENABLED(CONFIG_LED_IS31FL3235A_COLOR_MATRIX,			\
+			   (.matrices = is31fl3235a_matrices_##inst,))		\
+		IF_ENABLED(CONFIG_LED_IS31FL3235A_REMAP,			\
+			   (.channel_map = COND_CODE_1(				\
+				DT_INST_NODE_HAS_PROP(inst, channel_map),	\
+				(is31fl3235a_channel_map_##inst), (NULL)),))	\
+		IF_ENABLED(CONFIG_LED_IS31FL3235A_CURRENT_LIMIT,		\
+			   (.imax_ua = DT_INST_PROP(inst, imax_microamp),	\
+			    .budget_ua = DT_INST_PROP(inst,			\
+						      current_budget_microamp),))\
+		IF_ENABLED(CONFIG_LED_IS31FL3235A_RETAINED_STATE,		\
+			   (.retained = &is31fl3235a_retained_##inst,))		\
+		IF_ENABLED(CONFIG_LED_IS31FL3235A_FRAME_QUEUE,			\
+			   (.queue_buf = is31fl3235a_queue_buf_##inst,))	\
+		IF_ENABLED(CONFIG_LED_IS31FL3235A_PARTITIONS,			\
+			   (.part_masks = is31fl3235a_part_masks_##inst,))	\
 	};									\
 										\
+	PM_DEVICE_DT_INST_DEFINE(inst, is31fl3235a_pm_action);			\
+										\
 	DEVICE_DT_INST_DEFINE(inst,						\
 			      is31fl3235a_init,					\
-			      NULL,						\
+			      PM_DEVICE_DT_INST_GET(inst),			\
 			      &is31fl3235a_data_##inst,				\
 			      &is31fl3235a_cfg_##inst,				\
 			      POST_KERNEL,					\
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_LED_IS31FL3235A_EASE_H_
+#define ZEPHYR_DRIVERS_LED_IS31FL3235A_EASE_H_
+
+/**
+ * @file
+ * @brief Easing curve points and evaluation for IS31FL3235A transitions
+ *
+ * Curves are 17 points at x = n / 16 in Q15. Progress is Q16: its top 4
+ * bits select a segment and the remaining 12 interpolate within it, in
+ * integer arithmetic. Kept apart from the driver so the evaluation can be
+ * measured on the host.
+ */
+
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+/* Transition progress is Q16; the top 4 bits select a curve segment */
+#define IS31FL3235A_EASE_T_BITS		16
+#define IS31FL3235A_EASE_T_ONE		BIT(IS31FL3235A_EASE_T_BITS)
+#define IS31FL3235A_EASE_SEG_BITS	4
+#define IS31FL3235A_EASE_SEGS		BIT(IS31FL3235A_EASE_SEG_BITS)
+
+/*
+ * Built-in easing curves sampled at x = n / 16, in Q15. The driver
+ * generates its tables from these closed forms with LISTIFY, so they
+ * cannot drift from the formulas and need no initialization.
+ */
+#define IS31FL3235A_EASE_PT_LINEAR(n, _)	((n) * 2048)
+#define IS31FL3235A_EASE_PT_IN_QUAD(n, _)	((n) * (n) * 128)
+#define IS31FL3235A_EASE_PT_OUT_QUAD(n, _)	(32768 - (16 - (n)) * (16 - (n)) * 128)
+#define IS31FL3235A_EASE_PT_IN_OUT_QUAD(n, _)					\
+	((n) < 8 ? (n) * (n) * 256 : 32768 - (16 - (n)) * (16 - (n)) * 256)
+#define IS31FL3235A_EASE_PT_IN_CUBIC(n, _)	((n) * (n) * (n) * 8)
+#define IS31FL3235A_EASE_PT_OUT_CUBIC(n, _)					\
+	(32768 - (16 - (n)) * (16 - (n)) * (16 - (n)) * 8)
+#define IS31FL3235A_EASE_PT_IN_OUT_CUBIC(n, _)					\
+	((n) < 8 ? (n) * (n) * (n) * 32 :					\
+		   32768 - (16 - (n)) * (16 - (n)) * (16 - (n)) * 32)
+#define IS31FL3235A_EASE_PT_SMOOTHSTEP(n, _)	((48 - 2 * (n)) * (n) * (n) * 8)
+
+/**
+ * @brief Evaluate an easing curve
+ *
+ * Looks up the segment with the top bits of @p t and interpolates
+ * linearly with the rest, in integer arithmetic.
+ *
+ * @param lut Curve points, IS31FL3235A_EASE_SEGS + 1 of them
+ * @param t Progress, 0 to IS31FL3235A_EASE_T_ONE
+ * @return Curve value, 0 to IS31FL3235A_EASE_ONE
+ */
+static inline uint32_t is31fl3235a_ease_eval(const uint16_t *lut, uint32_t t)
+{
+	uint32_t i = t >> (IS31FL3235A_EASE_T_BITS - IS31FL3235A_EASE_SEG_BITS);
+	int32_t f = t & BIT_MASK(IS31FL3235A_EASE_T_BITS - IS31FL3235A_EASE_SEG_BITS);
+
+	if (i >= IS31FL3235A_EASE_SEGS) {
+		return lut[IS31FL3235A_EASE_SEGS];
+	}
+
+	return lut[i] + ((((int32_t)lut[i + 1] - lut[i]) * f) >>
+			 (IS31FL3235A_EASE_T_BITS - IS31FL3235A_EASE_SEG_BITS));
+}
+
+#endif /* ZEPHYR_DRIVERS_LED_IS31FL3235A_EASE_H_ */
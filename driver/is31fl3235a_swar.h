@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_LED_IS31FL3235A_SWAR_H_
+#define ZEPHYR_DRIVERS_LED_IS31FL3235A_SWAR_H_
+
+/**
+ * @file
+ * @brief Word-parallel (SWAR) kernels for IS31FL3235A frame processing
+ *
+ * A frame of 28 8-bit PWM values is processed as 7 32-bit words of four
+ * lanes each. Lanes are split into even and odd bytes so that every
+ * multiplication has 8 bits of headroom and cannot carry into the
+ * neighbouring lane; additions and comparisons keep the lane top bits
+ * apart so carries and borrows never cross lanes.
+ *
+ * Each kernel has a scalar reference (is31fl3235a_ref_*) defining its
+ * exact per-lane result. The word-parallel versions produce identical
+ * output and run on any 32-bit core, including Cortex-M0 without DSP
+ * instructions.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#include "is31fl3235a_regs.h"
+
+/* Lanes per word and words per frame */
+#define IS31FL3235A_SWAR_LANES		4
+#define IS31FL3235A_FRAME_WORDS		(IS31FL3235A_NUM_CHANNELS / IS31FL3235A_SWAR_LANES)
+
+BUILD_ASSERT(IS31FL3235A_NUM_CHANNELS % IS31FL3235A_SWAR_LANES == 0,
+	     "frame must be a whole number of words");
+/* Channel 4 * i + n is byte lane n (bits 8n..8n+7) of word i */
+BUILD_ASSERT(!IS_ENABLED(CONFIG_BIG_ENDIAN),
+	     "SWAR lane mapping assumes a little-endian core");
+
+/* Even and odd byte lanes of a word */
+#define IS31FL3235A_SWAR_EVEN		0x00FF00FFU
+#define IS31FL3235A_SWAR_ODD		0xFF00FF00U
+/* 0.5 in each 16-bit product, for rounding */
+#define IS31FL3235A_SWAR_HALF		0x00800080U
+/* Top and low seven bits of each lane */
+#define IS31FL3235A_SWAR_HIGH		0x80808080U
+#define IS31FL3235A_SWAR_LOW7		0x7F7F7F7FU
+
+/*
+ * Scalar references: the exact per-lane result of each kernel below.
+ */
+
+/** Reference for is31fl3235a_swar_scale(): round(a * f / 256) */
+static inline uint8_t is31fl3235a_ref_scale(uint8_t a, uint32_t f)
+{
+	return (a * f + 128U) >> 8;
+}
+
+/** Reference for is31fl3235a_swar_scale_floor(): floor(a * f / 256) */
+static inline uint8_t is31fl3235a_ref_scale_floor(uint8_t a, uint32_t f)
+{
+	return (a * f) >> 8;
+}
+
+/** Reference for is31fl3235a_swar_lerp(): round((a * (256 - t) + b * t) / 256) */
+static inline uint8_t is31fl3235a_ref_lerp(uint8_t a, uint8_t b, uint32_t t)
+{
+	return (a * (256U - t) + b * t + 128U) >> 8;
+}
+
+/** Reference for is31fl3235a_frame_blend(): lerp by alpha, 255 = b */
+static inline uint8_t is31fl3235a_ref_blend(uint8_t a, uint8_t b, uint8_t alpha)
+{
+	return is31fl3235a_ref_lerp(a, b, alpha + (alpha >> 7));
+}
+
+/** Reference for is31fl3235a_frame_clear(): 0 where the channel bit is set */
+static inline uint8_t is31fl3235a_ref_clear(uint8_t a, bool clear)
+{
+	return clear ? 0U : a;
+}
+
+/**
+ * @brief One frame of PWM values, addressable per channel or per word
+ */
+union is31fl3235a_frame {
+	uint8_t b[IS31FL3235A_NUM_CHANNELS];
+	uint32_t w[IS31FL3235A_FRAME_WORDS];
+};
+
+/**
+ * @brief Convert a 0-255 level to a Q8 factor (255 maps to 256 = 1.0)
+ */
+static inline uint32_t is31fl3235a_q8(uint8_t level)
+{
+	return level + (level >> 7);
+}
+
+/**
+ * @brief Scale the four lanes of a word by a common Q8 factor, rounded
+ *
+ * @param w Four 8-bit lanes
+ * @param f Factor, 0-256 (256 = 1.0)
+ * @return Scaled lanes
+ */
+static inline uint32_t is31fl3235a_swar_scale(uint32_t w, uint32_t f)
+{
+	uint32_t even = (w & IS31FL3235A_SWAR_EVEN) * f + IS31FL3235A_SWAR_HALF;
+	uint32_t odd = ((w >> 8) & IS31FL3235A_SWAR_EVEN) * f + IS31FL3235A_SWAR_HALF;
+
+	return ((even >> 8) & IS31FL3235A_SWAR_EVEN) | (odd & IS31FL3235A_SWAR_ODD);
+}
+
+/**
+ * @brief Scale the four lanes of a word by a common Q8 factor, rounded down
+ *
+ * Never rounds a lane up, for limits that must not be exceeded.
+ *
+ * @param w Four 8-bit lanes
+ * @param f Factor, 0-256 (256 = 1.0)
+ * @return Scaled lanes
+ */
+static inline uint32_t is31fl3235a_swar_scale_floor(uint32_t w, uint32_t f)
+{
+	uint32_t even = (w & IS31FL3235A_SWAR_EVEN) * f;
+	uint32_t odd = ((w >> 8) & IS31FL3235A_SWAR_EVEN) * f;
+
+	return ((even >> 8) & IS31FL3235A_SWAR_EVEN) | (odd & IS31FL3235A_SWAR_ODD);
+}
+
+/**
+ * @brief Blend the four lanes of two words, rounded
+ *
+ * @param a Lanes selected at t = 0
+ * @param b Lanes selected at t = 256
+ * @param t Blend position, 0-256
+ * @return Blended lanes
+ */
+static inline uint32_t is31fl3235a_swar_lerp(uint32_t a, uint32_t b, uint32_t t)
+{
+	uint32_t s = 256U - t;
+	uint32_t even = (a & IS31FL3235A_SWAR_EVEN) * s +
+			(b & IS31FL3235A_SWAR_EVEN) * t + IS31FL3235A_SWAR_HALF;
+	uint32_t odd = ((a >> 8) & IS31FL3235A_SWAR_EVEN) * s +
+		       ((b >> 8) & IS31FL3235A_SWAR_EVEN) * t + IS31FL3235A_SWAR_HALF;
+
+	return ((even >> 8) & IS31FL3235A_SWAR_EVEN) | (odd & IS31FL3235A_SWAR_ODD);
+}
+
+/**
+ * @brief Expand the top bit of each lane to a full lane mask
+ */
+static inline uint32_t is31fl3235a_swar_lane_mask(uint32_t high)
+{
+	return (high >> 7) * 0xFFU;
+}
+
+/**
+ * @brief Expand four channel bits to a lane mask
+ *
+ * The multiply places bit n of @p bits at bit 8n (and nowhere else on
+ * a lane boundary); the result has lane n at 0xFF if bit n was set.
+ *
+ * @param bits Bitmap of the four lanes, bits 0-3
+ */
+static inline uint32_t is31fl3235a_swar_bits_mask(uint32_t bits)
+{
+	return (((bits & 0xFU) * 0x00204081U) & 0x01010101U) * 0xFFU;
+}
+
+/**
+ * @brief Per-lane select: lanes of @p b where @p m is 0xFF, else of @p a
+ */
+static inline uint32_t is31fl3235a_swar_select(uint32_t a, uint32_t b, uint32_t m)
+{
+	return (a & ~m) | (b & m);
+}
+
+/**
+ * @brief Bitmap of the lanes that differ between two frames
+ *
+ * @return Bit i set if channel i differs
+ */
+static inline uint32_t is31fl3235a_frame_diff(const union is31fl3235a_frame *a,
+					      const union is31fl3235a_frame *b)
+{
+	uint32_t mask = 0;
+
+	for (int i = 0; i < IS31FL3235A_FRAME_WORDS; i++) {
+		uint32_t x = a->w[i] ^ b->w[i];
+
+		if (x == 0U) {
+			continue;
+		}
+
+		/* Top bit of each lane set if the lane is non-zero */
+		x = (x | ((x & IS31FL3235A_SWAR_LOW7) + IS31FL3235A_SWAR_LOW7)) &
+		    IS31FL3235A_SWAR_HIGH;
+		for (int lane = 0; lane < IS31FL3235A_SWAR_LANES; lane++) {
+			if (x & BIT(lane * 8 + 7)) {
+				mask |= BIT(i * IS31FL3235A_SWAR_LANES + lane);
+			}
+		}
+	}
+
+	return mask;
+}
+
+/**
+ * @brief Scale every channel of a frame by a common Q8 factor, rounded
+ *
+ * @param frame Frame to scale in place
+ * @param f Factor, 0-256 (256 = 1.0)
+ */
+static inline void is31fl3235a_frame_scale(union is31fl3235a_frame *frame, uint32_t f)
+{
+	if (f >= 256U) {
+		return;
+	}
+
+	for (int i = 0; i < IS31FL3235A_FRAME_WORDS; i++) {
+		frame->w[i] = is31fl3235a_swar_scale(frame->w[i], f);
+	}
+}
+
+/**
+ * @brief Scale every channel of a frame by a common Q8 factor, rounded down
+ *
+ * @param frame Frame to scale in place
+ * @param f Factor, 0-256 (256 = 1.0)
+ */
+static inline void is31fl3235a_frame_scale_floor(union is31fl3235a_frame *frame,
+						 uint32_t f)
+{
+	if (f >= 256U) {
+		return;
+	}
+
+	for (int i = 0; i < IS31FL3235A_FRAME_WORDS; i++) {
+		frame->w[i] = is31fl3235a_swar_scale_floor(frame->w[i], f);
+	}
+}
+
+/**
+ * @brief Blend two frames channel by channel
+ *
+ * @param dst Output frame, may alias @p a or @p b
+ * @param a Frame selected at t = 0
+ * @param b Frame selected at t = 256
+ * @param t Blend position, 0-256
+ */
+static inline void is31fl3235a_frame_lerp(union is31fl3235a_frame *dst,
+					  const union is31fl3235a_frame *a,
+					  const union is31fl3235a_frame *b,
+					  uint32_t t)
+{
+	for (int i = 0; i < IS31FL3235A_FRAME_WORDS; i++) {
+		dst->w[i] = is31fl3235a_swar_lerp(a->w[i], b->w[i], t);
+	}
+}
+
+/**
+ * @brief Zero the channels of a frame selected by a bitmap
+ *
+ * @param frame Frame to modify in place
+ * @param bits Bitmap of channels to zero
+ */
+static inline void is31fl3235a_frame_clear(union is31fl3235a_frame *frame, uint32_t bits)
+{
+	for (int i = 0; i < IS31FL3235A_FRAME_WORDS && bits != 0U;
+	     i++, bits >>= IS31FL3235A_SWAR_LANES) {
+		frame->w[i] &= ~is31fl3235a_swar_bits_mask(bits);
+	}
+}
+
+/**
+ * @brief Blend a frame over another with per-channel opacity
+ *
+ * Opacity masks are mostly fully opaque or fully transparent: words whose
+ * lanes are all 0x00 or 0xFF are merged with one select, and only words
+ * with partial opacity fall back to the per-lane scalar blend, since four
+ * different factors do not fit in one multiply.
+ *
+ * @param dst Frame blended over, in place
+ * @param src Frame placed on top
+ * @param alpha Opacity of @p src per channel (0 = transparent, 255 = opaque)
+ */
+static inline void is31fl3235a_frame_blend(union is31fl3235a_frame *dst,
+					   const union is31fl3235a_frame *src,
+					   const union is31fl3235a_frame *alpha)
+{
+	for (int i = 0; i < IS31FL3235A_FRAME_WORDS; i++) {
+		uint32_t m = alpha->w[i];
+
+		if (m == is31fl3235a_swar_lane_mask(m & IS31FL3235A_SWAR_HIGH)) {
+			/* Every lane is 0x00 or 0xFF */
+			dst->w[i] = is31fl3235a_swar_select(dst->w[i], src->w[i], m);
+			continue;
+		}
+
+		for (int lane = 0; lane < IS31FL3235A_SWAR_LANES; lane++) {
+			int ch = i * IS31FL3235A_SWAR_LANES + lane;
+
+			dst->b[ch] = is31fl3235a_ref_blend(dst->b[ch], src->b[ch],
+							   alpha->b[ch]);
+		}
+	}
+}
+
+#endif /* ZEPHYR_DRIVERS_LED_IS31FL3235A_SWAR_H_ */
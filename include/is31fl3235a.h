@@ -19,6 +19,8 @@
  */
 
 #include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys_clock.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +43,227 @@ enum is31fl3235a_current_scale {
 	IS31FL3235A_SCALE_1_4X = 3,
 };
 
+/**
+ * @brief Channel number of an LED child node
+ *
+ * Resolves to the child's @c reg at build time, so LEDs can be addressed
+ * by role with no runtime lookup:
+ *
+ * @code{.c}
+ * led_set_brightness(dev, IS31FL3235A_DT_CHANNEL(DT_NODELABEL(led_red)), 50);
+ * @endcode
+ *
+ * @param node_id Node identifier of an IS31FL3235A child node
+ */
+#define IS31FL3235A_DT_CHANNEL(node_id) DT_REG_ADDR(node_id)
+
+/**
+ * @brief Logical LED number of an LED child node
+ *
+ * The index to pass to led_get_info() for the child, resolved at build
+ * time.
+ *
+ * @param node_id Node identifier of an IS31FL3235A child node
+ */
+#define IS31FL3235A_DT_LED(node_id) DT_NODE_CHILD_IDX(node_id)
+
+/**
+ * @brief Bitmap of the channels driven by an LED child node
+ *
+ * One bit per entry of the child's color-mapping, starting at its @c reg.
+ *
+ * @param node_id Node identifier of an IS31FL3235A child node
+ */
+#define IS31FL3235A_DT_CHANNELS(node_id)					\
+	(BIT_MASK(DT_PROP_LEN_OR(node_id, color_mapping, 1)) << DT_REG_ADDR(node_id))
+
+/** @cond INTERNAL_HIDDEN */
+#define IS31FL3235A_DT_GROUP_CHILD(node_id, group)				\
+	| ((DT_PROP_OR(node_id, group, -1) == (group)) ?			\
+	   IS31FL3235A_DT_CHANNELS(node_id) : 0U)
+/** @endcond */
+
+/**
+ * @brief Bitmap of the channels of all child nodes in a group
+ *
+ * Collects the children whose @c group property equals @p group, at build
+ * time, for is31fl3235a_set_channels() or is31fl3235a_effect_attach():
+ *
+ * @code{.c}
+ * #define STATUS_GROUP IS31FL3235A_DT_GROUP(DT_NODELABEL(led_controller), 1)
+ *
+ * is31fl3235a_set_channels(dev, STATUS_GROUP, 0);
+ * @endcode
+ *
+ * @param node_id Node identifier of an IS31FL3235A controller
+ * @param group Group number
+ */
+#define IS31FL3235A_DT_GROUP(node_id, group)					\
+	(0U DT_FOREACH_CHILD_VARGS(node_id, IS31FL3235A_DT_GROUP_CHILD, group))
+
+/** Calibration gain that leaves a channel unchanged (Q8 fixed point) */
+#define IS31FL3235A_GAIN_UNITY 256U
+
+/** Number of hue steps in a full color circle (256 per sextant) */
+#define IS31FL3235A_HUE_MAX 1536U
+
+/**
+ * @brief Hue value for an angle in degrees
+ *
+ * @param deg Angle (0-359)
+ */
+#define IS31FL3235A_HUE_DEG(deg) ((uint16_t)(((uint32_t)(deg) * IS31FL3235A_HUE_MAX) / 360U))
+
+/**
+ * @brief HSV color
+ */
+struct is31fl3235a_hsv {
+	/** Hue (0 to IS31FL3235A_HUE_MAX - 1; larger values wrap around) */
+	uint16_t h;
+	/** Saturation (0-255) */
+	uint8_t s;
+	/** Value (0-255) */
+	uint8_t v;
+};
+
+/**
+ * @brief I2C transfer outcome counters
+ *
+ * Every register write made by the driver is counted in exactly one of
+ * @ref ok, @ref retried, @ref recovered or @ref failed.
+ */
+struct is31fl3235a_i2c_stats {
+	/** Transfers that succeeded on the first attempt */
+	uint32_t ok;
+	/** Transfers that succeeded after one or more retries */
+	uint32_t retried;
+	/** Transfers that succeeded only after I2C bus recovery */
+	uint32_t recovered;
+	/** Transfers that failed after all retries and recovery */
+	uint32_t failed;
+	/** Total number of retry attempts */
+	uint32_t retries;
+};
+
+/**
+ * @brief Easing curves for transitions
+ */
+enum is31fl3235a_ease {
+	/** Constant speed */
+	IS31FL3235A_EASE_LINEAR,
+	/** Quadratic: slow start */
+	IS31FL3235A_EASE_IN_QUAD,
+	/** Quadratic: slow end */
+	IS31FL3235A_EASE_OUT_QUAD,
+	/** Quadratic: slow start and end */
+	IS31FL3235A_EASE_IN_OUT_QUAD,
+	/** Cubic: slow start */
+	IS31FL3235A_EASE_IN_CUBIC,
+	/** Cubic: slow end */
+	IS31FL3235A_EASE_OUT_CUBIC,
+	/** Cubic: slow start and end */
+	IS31FL3235A_EASE_IN_OUT_CUBIC,
+	/** Smoothstep (3x^2 - 2x^3): gentle start and end */
+	IS31FL3235A_EASE_SMOOTHSTEP,
+	/** Caller-supplied curve */
+	IS31FL3235A_EASE_CUSTOM,
+};
+
+/** Points of an easing curve, at x = 0, 1/16, ..., 1 */
+#define IS31FL3235A_EASE_POINTS 17
+
+/** Easing curve value standing for the end of the transition (Q15) */
+#define IS31FL3235A_EASE_ONE 32768U
+
+/**
+ * @brief Easing of a transition
+ *
+ * A zero-initialized value is linear.
+ */
+struct is31fl3235a_easing {
+	/** Curve */
+	enum is31fl3235a_ease type;
+	/** IS31FL3235A_EASE_CUSTOM: IS31FL3235A_EASE_POINTS values from 0
+	 *  to IS31FL3235A_EASE_ONE, linearly interpolated in between; must
+	 *  stay valid while in use
+	 */
+	const uint16_t *custom;
+};
+
+/**
+ * @brief Built-in effects
+ */
+enum is31fl3235a_effect_type {
+	/** All channels fade up and back down together */
+	IS31FL3235A_EFFECT_BREATHE,
+	/** All channels pulse twice per period, strong then weak */
+	IS31FL3235A_EFFECT_HEARTBEAT,
+	/** One channel lit at a time, stepping through the channels */
+	IS31FL3235A_EFFECT_CHASE,
+	/** Random channels flash and fade out */
+	IS31FL3235A_EFFECT_SPARKLE,
+	/** A lit channel stepping through the channels with a fading tail */
+	IS31FL3235A_EFFECT_COMET,
+};
+
+/** Longest effect period in milliseconds */
+#define IS31FL3235A_EFFECT_PERIOD_MAX_MS 3600000U
+
+/**
+ * @brief Effect parameters
+ */
+struct is31fl3235a_effect {
+	/** Effect type */
+	enum is31fl3235a_effect_type type;
+	/** One breath or beat, or one step per channel for chase, sparkle
+	 *  and comet, in milliseconds
+	 */
+	uint32_t period_ms;
+	/** Peak PWM value (0-255) */
+	uint8_t level;
+	/** Sparkle and comet: steps a channel takes to fade out once lit */
+	uint8_t tail;
+	/** Breathe: curve of the fade up, mirrored for the fade down */
+	struct is31fl3235a_easing ease;
+};
+
+/**
+ * @brief Channel partition handle (opaque)
+ */
+struct is31fl3235a_partition;
+
+/**
+ * @brief Frame queued for playback at a given time
+ */
+struct is31fl3235a_frame_entry {
+	/** Uptime at which the frame latches */
+	k_timepoint_t when;
+	/** PWM values of all 28 channels */
+	uint8_t pwm[28];
+};
+
+/**
+ * @brief Frame clock counters
+ *
+ * Counted from the last is31fl3235a_frame_clock_start().
+ */
+struct is31fl3235a_frame_clock_stats {
+	/** Clock ticks */
+	uint32_t ticks;
+	/** Frames committed; ticks with nothing composed commit nothing */
+	uint32_t frames;
+	/** Ticks dropped: the previous commit had not started yet, or the
+	 *  back buffer was leased at the time
+	 */
+	uint32_t missed;
+	/** Achieved rate of committed frames in millihertz */
+	uint32_t rate_mhz;
+	/** Mean delay from tick to commit in microseconds */
+	uint32_t jitter_avg_us;
+	/** Largest delay from tick to commit in microseconds */
+	uint32_t jitter_max_us;
+};
+
 /**
  * @brief Set current scaling for a channel
  *
@@ -157,6 +380,9 @@ int is31fl3235a_sw_shutdown(const struct device *dev, bool shutdown);
  * Hardware shutdown consumes less power than software shutdown but
  * requires a GPIO pin connection.
  *
+ * When waking, the register state is rewritten from the driver's shadow
+ * (see is31fl3235a_resync()).
+ *
  * @param dev Pointer to the device structure
  * @param shutdown true to shutdown (SDB low), false to wake (SDB high)
  *
@@ -188,6 +414,43 @@ int is31fl3235a_hw_shutdown(const struct device *dev, bool shutdown);
  */
 int is31fl3235a_global_enable(const struct device *dev, bool enable);
 
+/**
+ * @brief Rewrite all chip registers from the driver's shadow state
+ *
+ * The driver keeps a copy of every register it writes. This function
+ * replays that copy (PWM values, control registers, global control,
+ * PWM frequency and shutdown state) followed by a single update, in five
+ * I2C transactions.
+ *
+ * Call it after the chip may have lost its register contents, for example
+ * after a brown-out, an unexpected chip reset or an I2C error handler,
+ * instead of re-initializing the device. The driver calls it itself when
+ * leaving hardware shutdown.
+ *
+ * @param dev Pointer to the device structure
+ *
+ * @retval 0 On success
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_resync(const struct device *dev);
+
+/**
+ * @brief Read the I2C transfer outcome counters
+ *
+ * Failed writes are retried according to
+ * CONFIG_LED_IS31FL3235A_I2C_RETRIES with exponential backoff, followed
+ * by I2C bus recovery if CONFIG_LED_IS31FL3235A_I2C_BUS_RECOVERY is
+ * enabled. Registers whose write still failed stay marked dirty in the
+ * driver shadow and are rewritten by the next operation.
+ *
+ * @param dev Pointer to the device structure
+ * @param stats Filled with the counters accumulated since boot
+ *
+ * @retval 0 On success
+ */
+int is31fl3235a_get_i2c_stats(const struct device *dev,
+			      struct is31fl3235a_i2c_stats *stats);
+
 /**
  * @brief Manually trigger update of buffered register values
  *
@@ -301,6 +564,559 @@ int is31fl3235a_write_channels(const struct device *dev,
 				uint32_t num_channels,
 				const uint8_t *buf);
 
+/**
+ * @brief Set scattered channels to one brightness using a raw 0-255 value
+ *
+ * Writes every channel in @p channels in one pass with a single update,
+ * typically a group from IS31FL3235A_DT_GROUP().
+ *
+ * @param dev Pointer to the device structure
+ * @param channels Bitmap of channels (bit N = channel N)
+ * @param value Brightness value (0-255)
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Bit set beyond channel 27
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_set_channels(const struct device *dev,
+			     uint32_t channels,
+			     uint8_t value);
+
+/**
+ * @brief Convert an HSV color to RGB
+ *
+ * Uses 8-bit integer arithmetic only, for MCUs without an FPU.
+ *
+ * @param hsv Color to convert
+ * @param rgb Output: red, green and blue (0-255)
+ */
+void is31fl3235a_hsv_to_rgb(const struct is31fl3235a_hsv *hsv, uint8_t *rgb);
+
+/**
+ * @brief Set RGB LEDs from HSV colors
+ *
+ * Converts one HSV color per logical LED (device tree child node with a
+ * red/green/blue color-mapping) directly into the driver's shadow and
+ * writes all of them with a single update, so effects such as hue cycles
+ * need no floating point and no intermediate buffer in the application.
+ * Components other than red, green and blue are left unchanged.
+ *
+ * @param dev Pointer to the device structure
+ * @param start_led First logical LED number
+ * @param num_leds Number of consecutive logical LEDs
+ * @param hsv Array of @p num_leds colors
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid LED range or an LED without RGB components
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_write_hsv(const struct device *dev,
+			  uint32_t start_led,
+			  uint32_t num_leds,
+			  const struct is31fl3235a_hsv *hsv);
+
+/**
+ * @brief Set the master dimmer level
+ *
+ * Scales every channel by @p level / 255 while the PWM values are
+ * written to the chip. The values set through the API are kept, so they
+ * come back unchanged at full level. The whole PWM block is rewritten in
+ * one burst followed by a single update.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_DIMMER. The level is 255 after
+ * initialization.
+ *
+ * @param dev Pointer to the device structure
+ * @param level Dimmer level (0-255, 255 = no dimming)
+ *
+ * @retval 0 On success
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_set_master_brightness(const struct device *dev, uint8_t level);
+
+/**
+ * @brief Get the master dimmer level
+ *
+ * Requires CONFIG_LED_IS31FL3235A_DIMMER.
+ *
+ * @param dev Pointer to the device structure
+ *
+ * @return Current dimmer level (0-255)
+ */
+uint8_t is31fl3235a_get_master_brightness(const struct device *dev);
+
+/**
+ * @brief Set the total output current budget
+ *
+ * Frames whose estimated current (IMAX / current scale * PWM / 255,
+ * summed over enabled channels) exceeds the budget are scaled down by a
+ * common factor while being written to the chip. The values set through
+ * the API are kept.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_CURRENT_LIMIT. The initial budget is
+ * the current-budget-microamp device tree property.
+ *
+ * @param dev Pointer to the device structure
+ * @param budget_ua Budget in microamps, 0 for no limit
+ *
+ * @retval 0 On success
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_set_current_budget(const struct device *dev, uint32_t budget_ua);
+
+/**
+ * @brief Get the estimated output current of the last frame written
+ *
+ * Requires CONFIG_LED_IS31FL3235A_CURRENT_LIMIT.
+ *
+ * @param dev Pointer to the device structure
+ *
+ * @return Estimated current in microamps, after limiting
+ */
+uint32_t is31fl3235a_get_current(const struct device *dev);
+
+/**
+ * @brief Set calibration gains for consecutive channels
+ *
+ * Each PWM value is multiplied by its channel's gain while being written
+ * to the chip; values set through the API are kept unscaled, so a new
+ * gain takes effect on the current frame without the application
+ * rewriting it. Gains above unity boost and saturate at 255.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_CALIBRATION. Initial gains come from
+ * the color-gain child property, or are unity.
+ *
+ * @param dev Pointer to the device structure
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels
+ * @param gain Q8 gains, one per channel (IS31FL3235A_GAIN_UNITY = 1.0)
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid channel range
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_set_gain(const struct device *dev,
+			 uint32_t start_channel,
+			 uint32_t num_channels,
+			 const uint16_t *gain);
+
+/**
+ * @brief Set or clear the color correction matrix of an RGB LED
+ *
+ * The matrix maps the LED's logical red, green and blue values to the
+ * values written to the chip, before the channel gains are applied:
+ * out[row] = sum(matrix[row * 3 + col] * in[col]) / 256, clamped to
+ * 0-255. Useful for white balance and to correct color cross-talk.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_COLOR_MATRIX.
+ *
+ * @param dev Pointer to the device structure
+ * @param led Logical LED number of an RGB LED
+ * @param matrix Row-major 3x3 Q8 matrix (256 = 1.0), or NULL to remove
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid LED or an LED without RGB components
+ * @retval -ENOSPC Nine LEDs already have a matrix
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_set_color_matrix(const struct device *dev,
+				 uint32_t led,
+				 const int16_t *matrix);
+
+/**
+ * @brief Get a channel partition of a device
+ *
+ * Partitions group the channels of the child nodes sharing a partition
+ * property in device tree. Each has its own lock and dirty tracking, so
+ * subsystems owning different partitions stage their values without
+ * contending with each other; a single flusher merges them. Writes
+ * return once flushed, so they still wait for a transfer in progress.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_PARTITIONS.
+ *
+ * @param dev Pointer to the device structure
+ * @param index Partition number (0 to CONFIG_LED_IS31FL3235A_PARTITION_COUNT - 1)
+ *
+ * @return Partition handle, or NULL if @p index is out of range
+ */
+struct is31fl3235a_partition *is31fl3235a_partition_get(const struct device *dev,
+							 uint32_t index);
+
+/**
+ * @brief Get the channels owned by a partition
+ *
+ * Requires CONFIG_LED_IS31FL3235A_PARTITIONS.
+ *
+ * @param part Partition handle
+ *
+ * @return Bitmap of channel numbers
+ */
+uint32_t is31fl3235a_partition_channels(const struct is31fl3235a_partition *part);
+
+/**
+ * @brief Write PWM values to channels of a partition
+ *
+ * Same as is31fl3235a_write_channels() for channels the partition owns,
+ * but staged under the partition's own lock. Values written to the same
+ * channels through the device-wide API are overridden by the next
+ * partition write.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_PARTITIONS.
+ *
+ * @param part Partition handle
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels
+ * @param buf PWM values (0-255)
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid channel range
+ * @retval -EACCES A channel is not owned by the partition
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_partition_write(struct is31fl3235a_partition *part,
+				uint32_t start_channel,
+				uint32_t num_channels,
+				const uint8_t *buf);
+
+/**
+ * @brief Write PWM values into a compositor layer
+ *
+ * Layers are stacked above the values set through the other APIs, layer
+ * 0 lowest, and blended channel by channel according to their opacity
+ * whenever the frame is written to the chip. A layer is transparent
+ * until is31fl3235a_layer_set_opacity() says otherwise.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_COMPOSITOR.
+ *
+ * @param dev Pointer to the device structure
+ * @param layer Layer index (0 to CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS - 1)
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels
+ * @param buf PWM values (0-255)
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid layer or channel range
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_layer_write(const struct device *dev,
+			    uint32_t layer,
+			    uint32_t start_channel,
+			    uint32_t num_channels,
+			    const uint8_t *buf);
+
+/**
+ * @brief Set the per-channel opacity of a compositor layer
+ *
+ * Each channel shows alpha / 255 of the layer over (255 - alpha) / 255 of
+ * what lies below. Fully opaque and fully transparent channels are the
+ * cheapest to blend. Setting a layer's opacity to 0 releases its
+ * channels to the layers below.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_COMPOSITOR.
+ *
+ * @param dev Pointer to the device structure
+ * @param layer Layer index (0 to CONFIG_LED_IS31FL3235A_COMPOSITOR_LAYERS - 1)
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels
+ * @param alpha Opacity per channel (0 = transparent, 255 = opaque)
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid layer or channel range
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_layer_set_opacity(const struct device *dev,
+				  uint32_t layer,
+				  uint32_t start_channel,
+				  uint32_t num_channels,
+				  const uint8_t *alpha);
+
+/**
+ * @brief Compose PWM values into the back buffer
+ *
+ * Writes into the frame being composed without touching the shadow or
+ * the chip; nothing becomes visible until is31fl3235a_frame_commit().
+ * Several threads may compose into the same frame.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAMEBUFFER.
+ *
+ * @param dev Pointer to the device structure
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels
+ * @param buf PWM values (0-255)
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid channel range
+ */
+int is31fl3235a_frame_write(const struct device *dev,
+			    uint32_t start_channel,
+			    uint32_t num_channels,
+			    const uint8_t *buf);
+
+/**
+ * @brief Read PWM values back from the back buffer
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAMEBUFFER.
+ *
+ * @param dev Pointer to the device structure
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels
+ * @param buf Receives the composed PWM values
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid channel range
+ */
+int is31fl3235a_frame_read(const struct device *dev,
+			   uint32_t start_channel,
+			   uint32_t num_channels,
+			   uint8_t *buf);
+
+/**
+ * @brief Lease the back buffer for composition in place
+ *
+ * Returns a pointer to the driver's back buffer, indexed by channel, so
+ * a frame can be rendered into it directly instead of into a local array
+ * that is then copied in. The driver's own copies on the way to the bus
+ * remain. Other composers and commits wait until the lease
+ * is returned with is31fl3235a_frame_release(); the chip and the shadow
+ * are unaffected, so flushes from other threads continue meanwhile.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAMEBUFFER.
+ *
+ * @param dev Pointer to the device structure
+ * @param timeout How long to wait for a lease held elsewhere
+ * @param frame Receives a pointer to the 28 PWM values
+ *
+ * @retval 0 On success
+ * @retval -EAGAIN The back buffer stayed leased until @p timeout
+ */
+int is31fl3235a_frame_lease(const struct device *dev,
+			    k_timeout_t timeout,
+			    uint8_t **frame);
+
+/**
+ * @brief Return a leased back buffer
+ *
+ * Must be called by the thread holding the lease. The pointer obtained
+ * from is31fl3235a_frame_lease() must not be used afterwards.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAMEBUFFER.
+ *
+ * @param dev Pointer to the device structure
+ * @param dirty Bitmap of the channels written through the lease, to be
+ *              published by the first is31fl3235a_frame_commit() that
+ *              starts after this call returns
+ *
+ * @retval 0 On success
+ * @retval -EPERM The calling thread does not hold the lease; @p dirty is
+ *                ignored
+ * @retval -EINVAL @p dirty names channels above 27 (lease still returned)
+ */
+int is31fl3235a_frame_release(const struct device *dev, uint32_t dirty);
+
+/**
+ * @brief Start committing the back buffer at a fixed rate
+ *
+ * A kernel timer ticks at @p fps and every tick commits the channels
+ * composed since the previous one, as is31fl3235a_frame_commit() would,
+ * from the system work queue. Animations then only compose; frames reach
+ * the LEDs at a steady cadence. A tick finding the back buffer leased or
+ * the previous commit still queued is counted as missed and the frame
+ * goes out on the next tick. Restarting resets the statistics.
+ *
+ * The achievable period is rounded to the kernel tick
+ * (CONFIG_SYS_CLOCK_TICKS_PER_SEC).
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAME_CLOCK.
+ *
+ * @param dev Pointer to the device structure
+ * @param fps Frame rate (1-1000)
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid frame rate
+ */
+int is31fl3235a_frame_clock_start(const struct device *dev, uint32_t fps);
+
+/**
+ * @brief Stop the frame clock
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAME_CLOCK.
+ *
+ * @param dev Pointer to the device structure
+ *
+ * @retval 0 On success
+ */
+int is31fl3235a_frame_clock_stop(const struct device *dev);
+
+/**
+ * @brief Read the frame clock statistics
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAME_CLOCK.
+ *
+ * @param dev Pointer to the device structure
+ * @param stats Filled with the counters since the clock was started
+ *
+ * @retval 0 On success
+ */
+int is31fl3235a_get_frame_clock_stats(const struct device *dev,
+				      struct is31fl3235a_frame_clock_stats *stats);
+
+/**
+ * @brief Publish the composed frame and write it with a single update
+ *
+ * Every channel written to the back buffer since the last commit is
+ * copied into the driver's shadow at once, so a flush or update trigger
+ * from another thread sees either the whole frame or none of it.
+ * Channels not composed keep their current value, including values set
+ * directly with is31fl3235a_write_channels(). The back buffer keeps its
+ * contents as the starting point of the next frame.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAMEBUFFER.
+ *
+ * @param dev Pointer to the device structure
+ *
+ * @retval 0 On success
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_frame_commit(const struct device *dev);
+
+/**
+ * @brief Latch the prepared frame at a given uptime
+ *
+ * The prepared frame is written to the chip's staging registers at once:
+ * the channels composed in the back buffer with
+ * CONFIG_LED_IS31FL3235A_FRAMEBUFFER, otherwise whatever was set with the
+ * *_no_update() functions. At @p when only the update register is
+ * written, so the LEDs change within one short I2C write of the deadline.
+ * A time in the past latches immediately.
+ *
+ * Until the latch, other PWM writes and update triggers stay in the
+ * driver's shadow, so they cannot overwrite or latch the preloaded frame;
+ * they go out right after the latch. Control register writes are not
+ * held and take effect with the latch.
+ *
+ * The latch is written from the system work queue, so its delay past
+ * @p when is bounded by the kernel tick and whatever else runs on that
+ * queue, plus one 1-byte I2C write.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_SCHEDULED_COMMIT.
+ *
+ * @param dev Pointer to the device structure
+ * @param when Uptime to latch at, e.g. sys_timepoint_calc(K_MSEC(20))
+ *
+ * @retval 0 On success, the frame is preloaded
+ * @retval -EBUSY An earlier scheduled commit has not latched yet
+ * @retval -EIO I2C communication error while preloading
+ */
+int is31fl3235a_commit_at(const struct device *dev, k_timepoint_t when);
+
+/**
+ * @brief Queue a frame for playback at a given uptime
+ *
+ * The driver plays queued frames back on its own, in queue order: each
+ * is written to the chip's staging registers as soon as the previous one
+ * latched, and latched with a single update write at its time, as with
+ * is31fl3235a_commit_at(). Timestamps must not decrease; a frame whose
+ * time has passed latches immediately. Frames replace all 28 channels.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAME_QUEUE.
+ *
+ * @param dev Pointer to the device structure
+ * @param when Uptime to latch at
+ * @param pwm PWM values of all 28 channels, copied into the queue
+ * @param timeout How long to wait for room in a full queue
+ *
+ * @retval 0 On success
+ * @retval -EAGAIN The queue stayed full until @p timeout
+ */
+int is31fl3235a_queue_frame(const struct device *dev,
+			    k_timepoint_t when,
+			    const uint8_t *pwm,
+			    k_timeout_t timeout);
+
+/**
+ * @brief Drop the queued frames
+ *
+ * The frame already preloaded, if any, still latches at its time.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FRAME_QUEUE.
+ *
+ * @param dev Pointer to the device structure
+ *
+ * @retval 0 On success
+ */
+int is31fl3235a_queue_clear(const struct device *dev);
+
+/**
+ * @brief Fade channels to new PWM values
+ *
+ * Starts the transition and returns; the channels advance every
+ * CONFIG_LED_IS31FL3235A_FADE_TICK_MS from their current values along
+ * the easing curve. A channel already fading is taken over by the new
+ * fade, and a zero @p duration_ms sets the values at once, which also
+ * stops any fade on the channels. Values written to fading channels
+ * through other calls last until the next tick of the fade.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_FADE.
+ *
+ * @param dev Pointer to the device structure
+ * @param start_channel First channel number (0-27)
+ * @param num_channels Number of consecutive channels
+ * @param target Final PWM values (0-255)
+ * @param duration_ms Length of the transition in milliseconds
+ * @param ease Easing curve, or NULL for linear
+ *
+ * @retval 0 On success
+ * @retval -EINVAL Invalid channel range or easing
+ * @retval -ENOSPC CONFIG_LED_IS31FL3235A_FADE_SLOTS fades already running
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_fade(const struct device *dev,
+		     uint32_t start_channel,
+		     uint32_t num_channels,
+		     const uint8_t *target,
+		     uint32_t duration_ms,
+		     const struct is31fl3235a_easing *ease);
+
+/**
+ * @brief Run a built-in effect on a set of channels
+ *
+ * The effect starts from dark and advances every
+ * CONFIG_LED_IS31FL3235A_EFFECT_TICK_MS, writing only the channels it
+ * changes. Chase, sparkle and comet step through the channels in
+ * ascending order. Values written to the channels through other calls
+ * last until the effect changes them again.
+ *
+ * Requires CONFIG_LED_IS31FL3235A_EFFECTS.
+ *
+ * @param dev Pointer to the device structure
+ * @param channels Bitmap of channels to drive (bits 0-27)
+ * @param effect Effect parameters; @p period_ms from the effect tick to
+ *               IS31FL3235A_EFFECT_PERIOD_MAX_MS
+ *
+ * @return Effect handle (>= 0) on success, negative errno otherwise
+ * @retval -EINVAL Invalid channels or parameters
+ * @retval -EBUSY A channel is already driven by another effect
+ * @retval -ENOSPC CONFIG_LED_IS31FL3235A_EFFECT_SLOTS effects already attached
+ * @retval -EIO I2C communication error; the effect is not attached
+ */
+int is31fl3235a_effect_attach(const struct device *dev,
+			      uint32_t channels,
+			      const struct is31fl3235a_effect *effect);
+
+/**
+ * @brief Stop an effect and turn its channels off
+ *
+ * Requires CONFIG_LED_IS31FL3235A_EFFECTS.
+ *
+ * @param dev Pointer to the device structure
+ * @param handle Handle returned by is31fl3235a_effect_attach()
+ *
+ * @retval 0 On success
+ * @retval -EINVAL No effect attached with @p handle
+ * @retval -EIO I2C communication error
+ */
+int is31fl3235a_effect_detach(const struct device *dev, int handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2026
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host timing: every frame kernel of is31fl3235a_swar.h against a loop of
+ * its scalar reference over the same 28 channels, then one fade step
+ * (is31fl3235a_ease_eval() plus the per-channel interpolation) done with
+ * a per-channel loop and with the lerp kernel. Built without the
+ * compiler's auto-vectorizer so the scalar loops stay byte-at-a-time, as
+ * on the Cortex-M targets; the numbers are host nanoseconds and only the
+ * ratio between the columns carries over.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "is31fl3235a_ease.h"
+#include "is31fl3235a_swar.h"
+
+#define BENCH_FRAMES 64
+#define BENCH_ROUNDS 50000
+/* Each timing is the fastest of this many runs, to shed scheduler noise */
+#define BENCH_REPEAT 7
+/* Fade steps per timing run, progress sweeping the whole curve */
+#define BENCH_STEPS (BENCH_ROUNDS * BENCH_FRAMES)
+
+static union is31fl3235a_frame in_a[BENCH_FRAMES];
+static union is31fl3235a_frame in_b[BENCH_FRAMES];
+static union is31fl3235a_frame in_alpha[BENCH_FRAMES];
+static uint32_t in_factor[BENCH_FRAMES];
+static uint32_t in_bits[BENCH_FRAMES];
+static uint16_t smoothstep[IS31FL3235A_EASE_SEGS + 1];
+
+/* Folds every result in, so no loop can be dropped as dead */
+static volatile uint32_t sink;
+
+static uint32_t rng_state = 0x2545F491U;
+
+static uint32_t rng(void)
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+
+	return rng_state;
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t fold(const union is31fl3235a_frame *frame)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < IS31FL3235A_FRAME_WORDS; i++) {
+		sum = (sum << 1 | sum >> 31) ^ frame->w[i];
+	}
+
+	return sum;
+}
+
+enum kernel {
+	K_SCALE,
+	K_SCALE_FLOOR,
+	K_LERP,
+	K_BLEND,
+	K_DIFF,
+	K_CLEAR,
+	K_COUNT,
+};
+
+static const char *const kernel_name[K_COUNT] = {
+	"scale", "scale_floor", "lerp", "blend", "diff", "clear",
+};
+
+static void run_swar(enum kernel k, union is31fl3235a_frame *dst, int j)
+{
+	switch (k) {
+	case K_SCALE:
+		*dst = in_a[j];
+		is31fl3235a_frame_scale(dst, in_factor[j]);
+		break;
+	case K_SCALE_FLOOR:
+		*dst = in_a[j];
+		is31fl3235a_frame_scale_floor(dst, in_factor[j]);
+		break;
+	case K_LERP:
+		is31fl3235a_frame_lerp(dst, &in_a[j], &in_b[j], in_factor[j]);
+		break;
+	case K_BLEND:
+		*dst = in_a[j];
+		is31fl3235a_frame_blend(dst, &in_b[j], &in_alpha[j]);
+		break;
+	case K_DIFF:
+		dst->w[0] = is31fl3235a_frame_diff(&in_a[j], &in_b[j]);
+		break;
+	case K_CLEAR:
+		*dst = in_a[j];
+		is31fl3235a_frame_clear(dst, in_bits[j]);
+		break;
+	default:
+		break;
+	}
+}
+
+static void run_ref(enum kernel k, union is31fl3235a_frame *dst, int j)
+{
+	const uint8_t *a = in_a[j].b;
+	const uint8_t *b = in_b[j].b;
+	const uint32_t f = in_factor[j];
+	const int n = IS31FL3235A_NUM_CHANNELS;
+	uint32_t diff = 0;
+
+	switch (k) {
+	case K_SCALE:
+		for (int i = 0; i < n; i++) {
+			dst->b[i] = is31fl3235a_ref_scale(a[i], f);
+		}
+		break;
+	case K_SCALE_FLOOR:
+		for (int i = 0; i < n; i++) {
+			dst->b[i] = is31fl3235a_ref_scale_floor(a[i], f);
+		}
+		break;
+	case K_LERP:
+		for (int i = 0; i < n; i++) {
+			dst->b[i] = is31fl3235a_ref_lerp(a[i], b[i], f);
+		}
+		break;
+	case K_BLEND:
+		for (int i = 0; i < n; i++) {
+			dst->b[i] = is31fl3235a_ref_blend(a[i], b[i], in_alpha[j].b[i]);
+		}
+		break;
+	case K_DIFF:
+		for (int i = 0; i < n; i++) {
+			diff |= (uint32_t)(a[i] != b[i]) << i;
+		}
+		dst->w[0] = diff;
+		break;
+	case K_CLEAR:
+		for (int i = 0; i < n; i++) {
+			dst->b[i] = is31fl3235a_ref_clear(a[i], (in_bits[j] >> i) & 1U);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static double time_kernel_once(enum kernel k, bool swar)
+{
+	union is31fl3235a_frame dst = {0};
+	uint32_t sum = 0;
+	uint64_t start = now_ns();
+
+	for (int round = 0; round < BENCH_ROUNDS; round++) {
+		for (int j = 0; j < BENCH_FRAMES; j++) {
+			if (swar) {
+				run_swar(k, &dst, j);
+			} else {
+				run_ref(k, &dst, j);
+			}
+			sum += fold(&dst);
+		}
+	}
+	sink = sum;
+
+	return (double)(now_ns() - start) / ((double)BENCH_ROUNDS * BENCH_FRAMES);
+}
+
+static double time_kernel(enum kernel k, bool swar)
+{
+	double best = time_kernel_once(k, swar);
+
+	for (int r = 1; r < BENCH_REPEAT; r++) {
+		best = MIN(best, time_kernel_once(k, swar));
+	}
+
+	return best;
+}
+
+static uint32_t step_t(int step)
+{
+	return (uint32_t)step % (IS31FL3235A_EASE_T_ONE + 1U);
+}
+
+static double time_ease_once(void)
+{
+	uint32_t sum = 0;
+	uint64_t start = now_ns();
+
+	for (int step = 0; step < BENCH_STEPS; step++) {
+		sum += is31fl3235a_ease_eval(smoothstep, step_t(step));
+	}
+	sink = sum;
+
+	return (double)(now_ns() - start) / BENCH_STEPS;
+}
+
+/* Fade step as a loop over the fade's channels, Q15 curve value */
+static uint32_t fade_step_loop(union is31fl3235a_frame *cur, int j, uint32_t t)
+{
+	const uint8_t *from = in_a[j].b;
+	const uint8_t *to = in_b[j].b;
+	int32_t y = is31fl3235a_ease_eval(smoothstep, t);
+	uint32_t changed = 0;
+
+	for (uint32_t bits = in_bits[j]; bits != 0U; bits &= bits - 1U) {
+		uint32_t ch = __builtin_ctz(bits);
+		uint8_t v = from[ch] + ((((int32_t)to[ch] - from[ch]) * y) >> 15);
+
+		if (v != cur->b[ch]) {
+			cur->b[ch] = v;
+			changed |= BIT(ch);
+		}
+	}
+
+	return changed;
+}
+
+/* Fade step as the driver does it: lerp kernel, then the frame diff */
+static uint32_t fade_step_frame(union is31fl3235a_frame *cur, int j, uint32_t t)
+{
+	union is31fl3235a_frame v;
+	uint32_t y = is31fl3235a_ease_eval(smoothstep, t);
+	uint32_t changed;
+
+	is31fl3235a_frame_lerp(&v, &in_a[j], &in_b[j], (y + 64U) >> 7);
+	changed = is31fl3235a_frame_diff(&v, cur) & in_bits[j];
+	for (uint32_t bits = changed; bits != 0U; bits &= bits - 1U) {
+		uint32_t ch = __builtin_ctz(bits);
+
+		cur->b[ch] = v.b[ch];
+	}
+
+	return changed;
+}
+
+static double time_fade_once(bool frame)
+{
+	union is31fl3235a_frame cur = {0};
+	uint32_t sum = 0;
+	uint64_t start = now_ns();
+
+	for (int step = 0; step < BENCH_STEPS; step++) {
+		int j = step % BENCH_FRAMES;
+
+		if (frame) {
+			sum += fade_step_frame(&cur, j, step_t(step));
+		} else {
+			sum += fade_step_loop(&cur, j, step_t(step));
+		}
+	}
+	sink = sum + fold(&cur);
+
+	return (double)(now_ns() - start) / BENCH_STEPS;
+}
+
+static double time_ease(void)
+{
+	double best = time_ease_once();
+
+	for (int r = 1; r < BENCH_REPEAT; r++) {
+		best = MIN(best, time_ease_once());
+	}
+
+	return best;
+}
+
+static double time_fade(bool frame)
+{
+	double best = time_fade_once(frame);
+
+	for (int r = 1; r < BENCH_REPEAT; r++) {
+		best = MIN(best, time_fade_once(frame));
+	}
+
+	return best;
+}
+
+/* Largest difference between the two fade steps over the whole curve */
+static int fade_max_error(void)
+{
+	int worst = 0;
+
+	for (uint32_t t = 0; t <= IS31FL3235A_EASE_T_ONE; t += 16U) {
+		for (int j = 0; j < BENCH_FRAMES; j++) {
+			union is31fl3235a_frame a = {0}, b = {0};
+
+			fade_step_loop(&a, j, t);
+			fade_step_frame(&b, j, t);
+			for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+				worst = MAX(worst, abs((int)a.b[i] - (int)b.b[i]));
+			}
+		}
+	}
+
+	return worst;
+}
+
+int main(void)
+{
+	for (uint32_t n = 0; n <= IS31FL3235A_EASE_SEGS; n++) {
+		smoothstep[n] = IS31FL3235A_EASE_PT_SMOOTHSTEP(n, _);
+	}
+
+	for (int j = 0; j < BENCH_FRAMES; j++) {
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			uint32_t r = rng();
+
+			in_a[j].b[i] = r;
+			/* A few changed channels per frame, as the limiter sees */
+			in_b[j].b[i] = (r >> 8) % 8U == 0U ? (uint8_t)(r >> 16) : in_a[j].b[i];
+			in_alpha[j].b[i] = (r & 0x3000000U) == 0U ? (uint8_t)(r >> 24) :
+					   ((r & 0x4000000U) != 0U ? 0xFFU : 0x00U);
+		}
+		in_factor[j] = rng() % 257U;
+		in_bits[j] = rng() & BIT_MASK(IS31FL3235A_NUM_CHANNELS);
+	}
+
+	printf("%-12s %10s %10s %8s\n", "kernel", "ref ns", "swar ns", "speedup");
+	for (int k = 0; k < K_COUNT; k++) {
+		double ref = time_kernel(k, false);
+		double swar = time_kernel(k, true);
+
+		printf("%-12s %10.1f %10.1f %7.2fx\n", kernel_name[k], ref, swar,
+		       ref / swar);
+	}
+
+	double ease = time_ease();
+	double loop = time_fade(false);
+	double frame = time_fade(true);
+
+	printf("\n%-12s %10.1f\n", "ease_eval", ease);
+	printf("%-12s %10s %10s %8s\n", "fade step", "loop ns", "lerp ns", "speedup");
+	printf("%-12s %10.1f %10.1f %7.2fx\n", "", loop, frame, loop / frame);
+	printf("%-12s %10d\n", "max |diff|", fade_max_error());
+
+	return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test: every word-parallel kernel of is31fl3235a_swar.h against its
+ * scalar reference. Word kernels are checked exhaustively over their lane
+ * values and factors, frame kernels on pseudo-random frames.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "is31fl3235a_swar.h"
+
+#define FRAME_ROUNDS 100000
+
+static unsigned int failures;
+
+#define CHECK(cond, ...)							\
+	do {									\
+		if (!(cond)) {							\
+			if (failures++ < 10) {					\
+				printf("FAIL %s:%d: ", __func__, __LINE__);	\
+				printf(__VA_ARGS__);				\
+				printf("\n");					\
+			}							\
+		}								\
+	} while (0)
+
+static uint32_t rng_state = 0x2545F491U;
+
+static uint32_t rng(void)
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+
+	return rng_state;
+}
+
+static uint8_t lane(uint32_t w, int n)
+{
+	return (w >> (n * 8)) & 0xFFU;
+}
+
+/* Four lanes derived from one value, so every lane sees every value */
+static uint32_t pack(uint8_t v)
+{
+	return (uint32_t)v | ((uint32_t)(uint8_t)(255U - v) << 8) |
+	       ((uint32_t)(uint8_t)(v * 7U) << 16) |
+	       ((uint32_t)(uint8_t)(v * 13U + 5U) << 24);
+}
+
+static void test_scale(void)
+{
+	for (uint32_t f = 0; f <= 256U; f++) {
+		for (uint32_t v = 0; v < 256U; v++) {
+			uint32_t w = pack(v);
+			uint32_t r = is31fl3235a_swar_scale(w, f);
+			uint32_t rf = is31fl3235a_swar_scale_floor(w, f);
+
+			for (int n = 0; n < IS31FL3235A_SWAR_LANES; n++) {
+				CHECK(lane(r, n) == is31fl3235a_ref_scale(lane(w, n), f),
+				      "scale %u * %u", lane(w, n), f);
+				CHECK(lane(rf, n) ==
+				      is31fl3235a_ref_scale_floor(lane(w, n), f),
+				      "scale_floor %u * %u", lane(w, n), f);
+			}
+		}
+	}
+}
+
+static void test_lerp(void)
+{
+	for (uint32_t t = 0; t <= 256U; t++) {
+		for (uint32_t a = 0; a < 256U; a++) {
+			for (uint32_t b = 0; b < 256U; b++) {
+				uint32_t wa = pack(a);
+				uint32_t wb = pack(b);
+				uint32_t r = is31fl3235a_swar_lerp(wa, wb, t);
+
+				for (int n = 0; n < IS31FL3235A_SWAR_LANES; n++) {
+					CHECK(lane(r, n) ==
+					      is31fl3235a_ref_lerp(lane(wa, n),
+								   lane(wb, n), t),
+					      "lerp %u %u at %u", lane(wa, n),
+					      lane(wb, n), t);
+				}
+			}
+		}
+	}
+}
+
+static void test_bits_mask(void)
+{
+	for (uint32_t bits = 0; bits < 16U; bits++) {
+		uint32_t m = is31fl3235a_swar_bits_mask(bits);
+
+		for (int n = 0; n < IS31FL3235A_SWAR_LANES; n++) {
+			CHECK(lane(m, n) == (((bits >> n) & 1U) != 0U ? 0xFFU : 0x00U),
+			      "bits_mask 0x%x lane %d", bits, n);
+		}
+	}
+}
+
+static void random_frame(union is31fl3235a_frame *frame)
+{
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		frame->b[i] = rng();
+	}
+}
+
+/* Opacity: mostly 0x00 / 0xFF words for the fast path, some partial */
+static void random_alpha(union is31fl3235a_frame *alpha)
+{
+	for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+		uint32_t r = rng();
+
+		alpha->b[i] = (r & 3U) == 0U ? (uint8_t)(r >> 8) :
+			      ((r & 4U) != 0U ? 0xFFU : 0x00U);
+	}
+}
+
+static void test_frames(void)
+{
+	for (int round = 0; round < FRAME_ROUNDS; round++) {
+		union is31fl3235a_frame a, b, alpha, dst;
+		uint32_t f = rng() % 257U;
+		uint32_t diff;
+
+		random_frame(&a);
+		memcpy(&b, &a, sizeof(b));
+		for (int k = rng() % 8U; k > 0; k--) {
+			b.b[rng() % IS31FL3235A_NUM_CHANNELS] = rng();
+		}
+		random_alpha(&alpha);
+
+		diff = is31fl3235a_frame_diff(&a, &b);
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			CHECK(((diff >> i) & 1U) == (a.b[i] != b.b[i]),
+			      "diff channel %d", i);
+		}
+
+		dst = a;
+		is31fl3235a_frame_blend(&dst, &b, &alpha);
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			CHECK(dst.b[i] == is31fl3235a_ref_blend(a.b[i], b.b[i], alpha.b[i]),
+			      "blend channel %d", i);
+		}
+
+		dst = a;
+		is31fl3235a_frame_scale(&dst, f);
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			CHECK(dst.b[i] == is31fl3235a_ref_scale(a.b[i], f),
+			      "frame_scale channel %d", i);
+		}
+
+		dst = a;
+		is31fl3235a_frame_scale_floor(&dst, f);
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			CHECK(dst.b[i] == is31fl3235a_ref_scale_floor(a.b[i], f),
+			      "frame_scale_floor channel %d", i);
+		}
+
+		random_frame(&b);
+		is31fl3235a_frame_lerp(&dst, &a, &b, f);
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			CHECK(dst.b[i] == is31fl3235a_ref_lerp(a.b[i], b.b[i], f),
+			      "frame_lerp channel %d", i);
+		}
+
+		diff = rng() & BIT_MASK(IS31FL3235A_NUM_CHANNELS);
+		dst = a;
+		is31fl3235a_frame_clear(&dst, diff);
+		for (int i = 0; i < IS31FL3235A_NUM_CHANNELS; i++) {
+			CHECK(dst.b[i] == is31fl3235a_ref_clear(a.b[i], (diff >> i) & 1U),
+			      "frame_clear channel %d", i);
+		}
+	}
+}
+
+int main(void)
+{
+	test_scale();
+	test_lerp();
+	test_bits_mask();
+	test_frames();
+
+	if (failures != 0U) {
+		printf("swar: %u mismatches\n", failures);
+		return 1;
+	}
+
+	printf("swar: all kernels match their references\n");
+
+	return 0;
+}
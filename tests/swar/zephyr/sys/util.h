@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * The few <zephyr/sys/util.h> macros used by is31fl3235a_swar.h, so the
+ * kernels build on the host without a Zephyr tree.
+ */
+
+#ifndef IS31FL3235A_TEST_ZEPHYR_SYS_UTIL_H_
+#define IS31FL3235A_TEST_ZEPHYR_SYS_UTIL_H_
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define CONFIG_BIG_ENDIAN 1
+#endif
+
+#define BIT(n) (1UL << (n))
+#define BIT_MASK(n) (BIT(n) - 1UL)
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define BUILD_ASSERT(cond, msg) _Static_assert(cond, msg)
+
+/* Same expansion trick as Zephyr: 1 if the macro is defined to 1, else 0 */
+#define Z_IS_ENABLED_XXXX1 Z_IS_ENABLED_YYYY,
+#define IS_ENABLED(config_macro) Z_IS_ENABLED1(config_macro)
+#define Z_IS_ENABLED1(config_macro) Z_IS_ENABLED2(Z_IS_ENABLED_XXXX##config_macro)
+#define Z_IS_ENABLED2(one_or_two_args) Z_IS_ENABLED3(one_or_two_args 1, 0)
+#define Z_IS_ENABLED3(ignore_this, val, ...) val
+
+#endif /* IS31FL3235A_TEST_ZEPHYR_SYS_UTIL_H_ */